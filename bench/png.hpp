@@ -0,0 +1,148 @@
+#ifndef _RIVEEXTENSION_BENCH_PNG_HPP_
+#define _RIVEEXTENSION_BENCH_PNG_HPP_
+
+/**
+ * Just enough PNG for the golden images of rive_bench: 8-bit RGBA, no filtering, and zlib "stored" (uncompressed)
+ * blocks, so neither side needs a deflate implementation. Files are larger than an optimizing encoder would write,
+ * but any viewer opens them. read_png() only accepts that same layout; an image re-saved by another tool has to be
+ * recorded again.
+ */
+
+// stdlib
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace png {
+
+static const uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+// Largest payload of one stored deflate block
+static const size_t STORED_BLOCK = 65535;
+
+inline uint32_t crc32(const uint8_t *data, size_t size, uint32_t crc = 0) {
+    static uint32_t table[256] = { 0 };
+    if (table[1] == 0) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+inline uint32_t adler32(const uint8_t *data, size_t size) {
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < size; i++) {
+        a = (a + data[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+inline void put_u32(std::vector<uint8_t> &out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) out.push_back((uint8_t)(value >> shift));
+}
+
+inline uint32_t get_u32(const uint8_t *data) {
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+}
+
+inline void put_chunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data) {
+    put_u32(out, (uint32_t)data.size());
+    const size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    put_u32(out, crc32(out.data() + start, out.size() - start));
+}
+
+/* Writes unpremultiplied RGBA8 rows (width * 4 bytes each) to a PNG file. */
+inline bool write_png(const std::string &path, const uint8_t *rgba, int width, int height) {
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)height * (width * 4 + 1));
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);  // filter: none
+        raw.insert(raw.end(), rgba + (size_t)y * width * 4, rgba + (size_t)(y + 1) * width * 4);
+    }
+
+    std::vector<uint8_t> zlib = { 0x78, 0x01 };
+    for (size_t offset = 0; offset < raw.size(); offset += STORED_BLOCK) {
+        const size_t length = std::min(STORED_BLOCK, raw.size() - offset);
+        zlib.push_back(offset + length >= raw.size() ? 1 : 0);
+        zlib.push_back((uint8_t)length);
+        zlib.push_back((uint8_t)(length >> 8));
+        zlib.push_back((uint8_t)~length);
+        zlib.push_back((uint8_t)(~length >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+    }
+    put_u32(zlib, adler32(raw.data(), raw.size()));
+
+    std::vector<uint8_t> header;
+    put_u32(header, width);
+    put_u32(header, height);
+    header.insert(header.end(), { 8, 6, 0, 0, 0 });  // 8 bits, RGBA, deflate, adaptive filters, no interlace
+
+    std::vector<uint8_t> out(SIGNATURE, SIGNATURE + 8);
+    put_chunk(out, "IHDR", header);
+    put_chunk(out, "IDAT", zlib);
+    put_chunk(out, "IEND", {});
+    std::ofstream file(path, std::ios::binary);
+    file.write((const char *)out.data(), out.size());
+    return (bool)file;
+}
+
+/* Reads a PNG written by write_png() into RGBA8 rows; returns false for anything else. */
+inline bool read_png(const std::string &path, std::vector<uint8_t> &rgba, int &width, int &height) {
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> in((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (in.size() < 8 || std::memcmp(in.data(), SIGNATURE, 8) != 0) return false;
+
+    std::vector<uint8_t> zlib;
+    width = height = 0;
+    for (size_t offset = 8; offset + 12 <= in.size();) {
+        const uint32_t length = get_u32(&in[offset]);
+        if (offset + 12 + length > in.size()) return false;
+        const std::string type((const char *)&in[offset + 4], 4);
+        const uint8_t *data = &in[offset + 8];
+        if (type == "IHDR") {
+            if (length != 13 || data[8] != 8 || data[9] != 6 || data[12] != 0) return false;
+            width = get_u32(data);
+            height = get_u32(data + 4);
+        } else if (type == "IDAT") {
+            zlib.insert(zlib.end(), data, data + length);
+        } else if (type == "IEND") {
+            break;
+        }
+        offset += 12 + length;
+    }
+    if (width <= 0 || height <= 0 || zlib.size() < 6 || (zlib[0] & 0x0f) != 8) return false;
+
+    std::vector<uint8_t> raw;
+    for (size_t offset = 2; offset + 5 <= zlib.size();) {
+        const uint8_t flags = zlib[offset];
+        if ((flags & 0x06) != 0) return false;  // compressed block
+        const size_t length = zlib[offset + 1] | (zlib[offset + 2] << 8);
+        if (offset + 5 + length > zlib.size()) return false;
+        raw.insert(raw.end(), zlib.begin() + offset + 5, zlib.begin() + offset + 5 + length);
+        offset += 5 + length;
+        if (flags & 1) break;
+    }
+
+    const size_t row = (size_t)width * 4;
+    if (raw.size() != (row + 1) * height) return false;
+    rgba.resize(row * height);
+    for (int y = 0; y < height; y++) {
+        if (raw[y * (row + 1)] != 0) return false;  // filtered row
+        std::memcpy(rgba.data() + y * row, raw.data() + y * (row + 1) + 1, row);
+    }
+    return true;
+}
+
+}  // namespace png
+
+#endif
@@ -0,0 +1,869 @@
+/**
+ * Standalone benchmark of the extension's raster pipeline: rive-cpp and the Skia renderer, driven the way
+ * SkiaInstance and RiveInstance drive them, without Godot. Build with `scons bench` from build/, then run from the
+ * repository root:
+ *
+ *     bench/bin/rive_bench [--examples demo/examples] [--sizes 256,512,1024] [--frames 120] [--repeat 5]
+ *                          [--kernels] [--out report.json] [--baseline baseline.json] [--threshold 0.1]
+ *                          [--golden record|compare] [--cases bench/golden/cases.txt] [--golden-dir bench/golden]
+ *                          [--tolerance 2] [--max-diff 0.001] [--selftest]
+ *
+ * Every .riv in the examples folder is imported, instantiated (default state machine, else first animation),
+ * advanced and rasterized at each size. Times are in milliseconds; the report is JSON with one flat metric per
+ * line, so two reports can be diffed directly. With --baseline, metrics slower than the baseline by more than the
+ * threshold are listed and the exit code is 1.
+ *
+ * With --golden, the examples are rendered at fixed frames instead (see Case) and compared against (or recorded as)
+ * PNGs in the golden folder, and each case's raster time is reported as `golden/<case>/raster_ms` for --baseline.
+ * When comparing, each case is also rendered through StaticLayer, the viewer's static_layer_cache path, and must match
+ * the direct render. Images that differ, as well as time regressions, make the exit code 1.
+ *
+ * --selftest runs the correctness checks of the engine-independent helpers instead (the pixel kernels against their
+ * scalar versions, and the tessellator) and needs no examples; any failed check makes the exit code 1.
+ */
+
+// stdlib
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// rive-cpp
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_input_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/renderer.hpp>
+
+// skia
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPictureRecorder.h"
+#include "include/core/SkSurface.h"
+
+#include <skia/renderer/include/skia_factory.hpp>
+#include <skia/renderer/include/skia_renderer.hpp>
+
+// extension
+#include "png.hpp"
+#include "static_layer.hpp"
+#include "utils/pixel_kernels.hpp"
+#include "utils/tessellator.hpp"
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+// Frame step used for every advance, matching a 60 fps process loop
+static const float BENCH_DELTA = 1.0f / 60.0f;
+// Baseline times below this are noise and never fail a comparison
+static const double BENCH_NOISE_FLOOR_MS = 0.05;
+
+struct Options {
+    std::string examples = "demo/examples";
+    std::vector<int> sizes = { 256, 512, 1024 };
+    int frames = 120;
+    int repeat = 5;
+    bool kernels = false;
+    bool selftest = false;
+    std::string out;
+    std::string baseline;
+    double threshold = 0.1;
+    std::string golden;
+    std::string cases;
+    std::string golden_dir = "bench/golden";
+    int tolerance = 2;
+    double max_diff = 0.001;
+};
+
+/* Metrics in insertion order, written one per line. */
+struct Report {
+    std::vector<std::pair<std::string, double>> metrics;
+
+    void add(const std::string &key, double value) {
+        metrics.emplace_back(key, value);
+    }
+};
+
+static double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static double median(std::vector<double> values) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+static double mean(const std::vector<double> &values) {
+    if (values.empty()) return 0;
+    double sum = 0;
+    for (double value : values) sum += value;
+    return sum / values.size();
+}
+
+static double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, (size_t)(values.size() * p))];
+}
+
+static long peak_memory_kb() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return (long)(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+static std::vector<uint8_t> read_bytes(const fs::path &path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+static std::unique_ptr<rive::File> import(const std::vector<uint8_t> &bytes, rive::Factory *factory) {
+    rive::ImportResult result;
+    auto file = rive::File::import(rive::Span<const uint8_t>(bytes.data(), bytes.size()), factory, &result);
+    return result == rive::ImportResult::success ? std::move(file) : nullptr;
+}
+
+/* An artboard with what the extension would play on it by default. */
+struct Instance {
+    std::unique_ptr<rive::ArtboardInstance> artboard;
+    std::unique_ptr<rive::StateMachineInstance> machine;
+    std::unique_ptr<rive::LinearAnimationInstance> animation;
+
+    /* Empty names pick the defaults; a name that doesn't exist leaves the artboard or machine null. */
+    explicit Instance(rive::File *file, const std::string &artboard_name = "", const std::string &machine_name = "") {
+        artboard = artboard_name.empty() ? file->artboardDefault() : file->artboardNamed(artboard_name);
+        if (!artboard) return;
+        if (!machine_name.empty()) machine = artboard->stateMachineNamed(machine_name);
+        else if (artboard->stateMachineCount() > 0) machine = artboard->stateMachineAt(0);
+        else if (artboard->animationCount() > 0) animation = artboard->animationAt(0);
+    }
+
+    bool advance(float delta) {
+        if (machine) return machine->advanceAndApply(delta);
+        if (animation) return animation->advanceAndApply(delta);
+        return artboard->advance(delta);
+    }
+};
+
+/* The raster half of SkiaInstance: a premultiplied surface, read back unpremultiplied. */
+struct Raster {
+    sk_sp<SkSurface> surface;
+    std::unique_ptr<rive::SkiaRenderer> renderer;
+    std::vector<uint8_t> pixels;
+    int size;
+
+    explicit Raster(int size_value) : size(size_value) {
+        surface = SkSurfaces::Raster(SkImageInfo::Make(size, size, kRGBA_8888_SkColorType, kPremul_SkAlphaType));
+        if (surface) renderer = std::make_unique<rive::SkiaRenderer>(surface->getCanvas());
+        pixels.resize((size_t)size * size * 4);
+    }
+
+    rive::Mat2D alignment(rive::ArtboardInstance *artboard) const {
+        return rive::computeAlignment(
+            rive::Fit::contain, rive::Alignment::center, rive::AABB(0, 0, size, size), artboard->bounds()
+        );
+    }
+
+    void draw(rive::ArtboardInstance *artboard) {
+        SkCanvas *canvas = surface->getCanvas();
+        canvas->resetMatrix();
+        canvas->clear(SkColors::kTransparent);
+        renderer->save();
+        renderer->transform(alignment(artboard));
+        artboard->draw(renderer.get());
+        renderer->restore();
+    }
+
+    /* The frame as a picture, recorded the way RiveViewerBase::record_frame() does. */
+    sk_sp<SkPicture> record(rive::ArtboardInstance *artboard) const {
+        SkPictureRecorder recorder;
+        rive::SkiaRenderer recording(recorder.beginRecording(SkRect::MakeWH(size, size)));
+        recording.save();
+        recording.transform(alignment(artboard));
+        artboard->draw(&recording);
+        recording.restore();
+        return recorder.finishRecordingAsPicture();
+    }
+
+    void copy() {
+        SkPixmap pm;
+        if (!surface->peekPixels(&pm)) return;
+        const size_t row = (size_t)size * 4;
+        for (int y = 0; y < size; y++) pixel_kernels::unpremultiply(pixels.data() + y * row, pm.addr8(0, y), size);
+    }
+};
+
+static void bench_file(const fs::path &path, const Options &options, rive::SkiaFactory *factory, Report &report) {
+    const std::string name = path.filename().string();
+    const std::vector<uint8_t> bytes = read_bytes(path);
+    std::unique_ptr<rive::File> file;
+
+    std::vector<double> import_ms;
+    for (int i = 0; i < options.repeat; i++) {
+        auto start = Clock::now();
+        file = import(bytes, factory);
+        import_ms.push_back(elapsed_ms(start));
+        if (!file) {
+            std::fprintf(stderr, "%s: import failed, skipped\n", name.c_str());
+            return;
+        }
+    }
+    report.add(name + "/import_ms", median(import_ms));
+
+    std::vector<double> instantiate_ms;
+    for (int i = 0; i < options.repeat; i++) {
+        auto start = Clock::now();
+        Instance instance(file.get());
+        instantiate_ms.push_back(elapsed_ms(start));
+    }
+    report.add(name + "/instantiate_ms", median(instantiate_ms));
+
+    Instance instance(file.get());
+    if (!instance.artboard) {
+        std::fprintf(stderr, "%s: no artboard, skipped\n", name.c_str());
+        return;
+    }
+    std::vector<double> advance_ms;
+    for (int i = 0; i < options.frames; i++) {
+        auto start = Clock::now();
+        instance.advance(BENCH_DELTA);
+        advance_ms.push_back(elapsed_ms(start));
+    }
+    report.add(name + "/advance_ms", mean(advance_ms));
+
+    for (int size : options.sizes) {
+        // A fresh instance per size, so every size rasterizes the same frames
+        Instance sized(file.get());
+        Raster raster(size);
+        if (!raster.surface) continue;
+        std::vector<double> raster_ms, copy_ms;
+        for (int i = 0; i < options.frames; i++) {
+            sized.advance(BENCH_DELTA);
+            auto start = Clock::now();
+            raster.draw(sized.artboard.get());
+            raster_ms.push_back(elapsed_ms(start));
+            start = Clock::now();
+            raster.copy();
+            copy_ms.push_back(elapsed_ms(start));
+        }
+        const std::string prefix = name + "/" + std::to_string(size) + "/";
+        report.add(prefix + "raster_ms", mean(raster_ms));
+        report.add(prefix + "raster_p95_ms", percentile(raster_ms, 0.95));
+        report.add(prefix + "copy_ms", mean(copy_ms));
+    }
+}
+
+/* Milliseconds per megapixel for each upload-path kernel. */
+static void bench_kernels(const Options &options, Report &report) {
+    const size_t count = 1024 * 1024;
+    std::vector<uint8_t> src(count * 4), dst(count * 4);
+    for (size_t i = 0; i < src.size(); i += 4) {
+        // Valid premultiplied pixels with every alpha value
+        const uint8_t a = (uint8_t)(i * 7);
+        src[i + 0] = std::min(a, (uint8_t)(i * 3));
+        src[i + 1] = std::min(a, (uint8_t)(i * 5));
+        src[i + 2] = a / 2;
+        src[i + 3] = a;
+    }
+    const std::vector<std::pair<std::string, std::function<void()>>> kernels = {
+        { "copy_rect", [&] { pixel_kernels::copy_rect(dst.data(), 4096, src.data(), 4096, 4096, 1024); } },
+        { "premultiply", [&] { pixel_kernels::premultiply(dst.data(), src.data(), count); } },
+        { "unpremultiply", [&] { pixel_kernels::unpremultiply(dst.data(), src.data(), count); } },
+        { "rgba_to_rgb", [&] { pixel_kernels::rgba_to_rgb(dst.data(), src.data(), count); } },
+        { "rgba_to_la8", [&] { pixel_kernels::rgba_to_la8(dst.data(), src.data(), count); } },
+        { "alpha_to_r8", [&] { pixel_kernels::alpha_to_r8(dst.data(), src.data(), count); } },
+    };
+    for (auto &kernel : kernels) {
+        std::vector<double> ms;
+        for (int i = 0; i < options.frames; i++) {
+            auto start = Clock::now();
+            kernel.second();
+            ms.push_back(elapsed_ms(start));
+        }
+        report.add(std::string("kernels/") + kernel.first + "_ms", median(ms));
+    }
+}
+
+/* Failed checks are printed as they happen and counted for the exit code. */
+struct SelfTest {
+    int checks = 0;
+    int failures = 0;
+
+    void check(bool passed, const std::string &what) {
+        checks++;
+        if (passed) return;
+        failures++;
+        std::fprintf(stderr, "FAIL %s\n", what.c_str());
+    }
+};
+
+static double mesh_area(const tessellator::Mesh &mesh) {
+    double area = 0;
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        const Vector2 a = mesh.points[mesh.indices[i]], b = mesh.points[mesh.indices[i + 1]];
+        const Vector2 c = mesh.points[mesh.indices[i + 2]];
+        area += std::abs((double)(b - a).cross(c - a)) * 0.5;
+    }
+    return area;
+}
+
+/* Most triangles covering one sample point; above 1, translucent paint would be blended twice there. */
+static int mesh_overlap(const tessellator::Mesh &mesh) {
+    if (mesh.points.empty()) return 0;
+    Vector2 low = mesh.points[0], high = mesh.points[0];
+    for (const Vector2 &point : mesh.points) {
+        low = Vector2(std::min(low.x, point.x), std::min(low.y, point.y));
+        high = Vector2(std::max(high.x, point.x), std::max(high.y, point.y));
+    }
+    int most = 0;
+    // Odd offsets keep samples off the band edges, where neighbouring triangles touch
+    for (float y = low.y + 0.0713f; y < high.y; y += 0.25f) {
+        for (float x = low.x + 0.0391f; x < high.x; x += 0.25f) {
+            int count = 0;
+            for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+                const Vector2 a = mesh.points[mesh.indices[i]], b = mesh.points[mesh.indices[i + 1]];
+                const Vector2 c = mesh.points[mesh.indices[i + 2]], p(x, y);
+                const float d0 = (b - a).cross(p - a), d1 = (c - b).cross(p - b), d2 = (a - c).cross(p - c);
+                if ((d0 > 0 && d1 > 0 && d2 > 0) || (d0 < 0 && d1 < 0 && d2 < 0)) count++;
+            }
+            most = std::max(most, count);
+        }
+    }
+    return most;
+}
+
+/* Checks every mesh must pass, then its area against the expected one (negative to skip). */
+static void check_mesh(SelfTest &test, const std::string &name, const tessellator::Mesh &mesh, double area) {
+    bool valid = mesh.indices.size() % 3 == 0;
+    for (int32_t index : mesh.indices) valid = valid && index >= 0 && (size_t)index < mesh.points.size();
+    for (const Vector2 &point : mesh.points) valid = valid && std::isfinite(point.x) && std::isfinite(point.y);
+    test.check(valid, "tessellator/" + name + ": indices in range and points finite");
+    if (!valid) return;
+    test.check(mesh_overlap(mesh) <= 1, "tessellator/" + name + ": no overlapping triangles");
+    if (area < 0) return;
+    const double actual = mesh_area(mesh);
+    test.check(
+        std::abs(actual - area) <= 1e-3 * std::max(1.0, area),
+        "tessellator/" + name + ": area " + std::to_string(actual) + ", expected " + std::to_string(area)
+    );
+}
+
+/* Degenerate and self-intersecting contours, the inputs rive-cpp hands the canvas backend least predictably. */
+static void selftest_tessellator(SelfTest &test) {
+    using namespace tessellator;
+    using Lines = std::vector<Polyline>;
+    const auto square = [](float x, float y, float size, bool reversed = false) {
+        Polyline line = { { Vector2(x, y), Vector2(x + size, y), Vector2(x + size, y + size), Vector2(x, y + size) } };
+        if (reversed) std::reverse(line.points.begin(), line.points.end());
+        return line;
+    };
+
+    // Fills
+    check_mesh(test, "fill/two_points", fill(Lines{ { { Vector2(0, 0), Vector2(4, 4) } } }, FillRule::NON_ZERO), 0);
+    const Lines collinear = { { { Vector2(0, 0), Vector2(1, 1), Vector2(3, 3) } } };
+    check_mesh(test, "fill/collinear", fill(collinear, FillRule::NON_ZERO), 0);
+    const Lines flat = { { { Vector2(0, 2), Vector2(4, 2), Vector2(1, 2) } } };
+    check_mesh(test, "fill/flat", fill(flat, FillRule::EVEN_ODD), 0);
+    Polyline repeated;
+    for (const Vector2 &point : square(0, 0, 2).points) repeated.points.insert(repeated.points.end(), 3, point);
+    check_mesh(test, "fill/repeated_points", fill(Lines{ repeated }, FillRule::NON_ZERO), 4);
+
+    const Lines bowtie = { { { Vector2(0, 0), Vector2(2, 0), Vector2(0, 2), Vector2(2, 2) } } };
+    check_mesh(test, "fill/bowtie_non_zero", fill(bowtie, FillRule::NON_ZERO), 2);
+    check_mesh(test, "fill/bowtie_even_odd", fill(bowtie, FillRule::EVEN_ODD), 2);
+
+    const Lines overlap = { square(0, 0, 2), square(1, 1, 2) };
+    check_mesh(test, "fill/overlap_non_zero", fill(overlap, FillRule::NON_ZERO), 7);
+    check_mesh(test, "fill/overlap_even_odd", fill(overlap, FillRule::EVEN_ODD), 6);
+    check_mesh(test, "fill/hole", fill(Lines{ square(0, 0, 4), square(1, 1, 2, true) }, FillRule::NON_ZERO), 12);
+
+    // A pentagram's centre is wound twice: filled under non-zero, a hole under even-odd
+    Polyline star;
+    const double radius = 10, pi = 3.14159265358979323846;
+    for (int i = 0; i < 5; i++) {
+        const double angle = pi * 2 * (i * 2 % 5) / 5;
+        star.points.push_back(Vector2(radius * std::sin(angle), -radius * std::cos(angle)));
+    }
+    const double inner = radius * std::cos(pi * 2 / 5) / std::cos(pi / 5);
+    const double pentagon = 2.5 * inner * inner * std::sin(pi * 2 / 5);
+    const double star_area = mesh_area(fill(Lines{ star }, FillRule::NON_ZERO));
+    check_mesh(test, "fill/pentagram_non_zero", fill(Lines{ star }, FillRule::NON_ZERO), -1);
+    check_mesh(test, "fill/pentagram_even_odd", fill(Lines{ star }, FillRule::EVEN_ODD), star_area - pentagon);
+
+    // Strokes
+    const Lines point = { { { Vector2(5, 5) } } };
+    check_mesh(test, "stroke/point_butt", stroke(point, 2, Join::MITER, Cap::BUTT, 0.1f), 0);
+    check_mesh(test, "stroke/point_square", stroke(point, 2, Join::MITER, Cap::SQUARE, 0.1f), 4);
+    const tessellator::Mesh dot = stroke(point, 2, Join::MITER, Cap::ROUND, 0.1f);
+    check_mesh(test, "stroke/point_round", dot, -1);
+    test.check(mesh_area(dot) > 0.9 * pi && mesh_area(dot) <= pi, "tessellator/stroke/point_round: area of a disc");
+    check_mesh(test, "stroke/zero_width", stroke(Lines{ square(0, 0, 4) }, 0, Join::MITER, Cap::BUTT, 0.1f), 0);
+
+    const Lines doubled = { { { Vector2(0, 0), Vector2(0, 0), Vector2(10, 0), Vector2(10, 0) } } };
+    check_mesh(test, "stroke/repeated_points", stroke(doubled, 2, Join::MITER, Cap::BUTT, 0.1f), 20);
+    Polyline closed = square(0, 0, 10);
+    closed.closed = true;
+    check_mesh(test, "stroke/closed_miter", stroke(Lines{ closed }, 2, Join::MITER, Cap::BUTT, 0.1f), 80);
+
+    const Lines crossing = { { { Vector2(0, 0), Vector2(10, 10), Vector2(10, 0), Vector2(0, 10) } } };
+    const Lines reversal = { { { Vector2(0, 0), Vector2(10, 0), Vector2(0, 0) } } };
+    for (Join join : { Join::MITER, Join::ROUND, Join::BEVEL }) {
+        const std::string suffix = join == Join::MITER ? "_miter" : join == Join::ROUND ? "_round" : "_bevel";
+        check_mesh(test, "stroke/crossing" + suffix, stroke(crossing, 2, join, Cap::BUTT, 0.1f), -1);
+        check_mesh(test, "stroke/reversal" + suffix, stroke(reversal, 2, join, Cap::BUTT, 0.1f), -1);
+    }
+}
+
+/* Every dispatched kernel against its scalar version: all (color, alpha) pairs, then every tail length and offset. */
+static void selftest_kernels(SelfTest &test) {
+    using Kernel = void (*)(uint8_t *, const uint8_t *, size_t);
+    struct Pair {
+        const char *name;
+        Kernel dispatched, scalar;
+        int dst_bytes;
+    };
+    const Pair kernels[] = {
+        { "premultiply", pixel_kernels::premultiply, pixel_kernels::scalar::premultiply, 4 },
+        { "unpremultiply", pixel_kernels::unpremultiply, pixel_kernels::scalar::unpremultiply, 4 },
+        { "rgba_to_rgb", pixel_kernels::rgba_to_rgb, pixel_kernels::scalar::rgba_to_rgb, 3 },
+        { "rgba_to_la8", pixel_kernels::rgba_to_la8, pixel_kernels::scalar::rgba_to_la8, 2 },
+        { "alpha_to_r8", pixel_kernels::alpha_to_r8, pixel_kernels::scalar::alpha_to_r8, 1 },
+    };
+    const std::string isa = pixel_kernels::isa();
+
+    // Color and alpha over all 65536 combinations, valid premultiplied or not
+    std::vector<uint8_t> all(256 * 256 * 4);
+    for (size_t i = 0; i < 256 * 256; i++) {
+        all[i * 4 + 0] = all[i * 4 + 1] = (uint8_t)i;
+        all[i * 4 + 2] = (uint8_t)(255 - i);
+        all[i * 4 + 3] = (uint8_t)(i >> 8);
+    }
+    for (const Pair &kernel : kernels) {
+        std::vector<uint8_t> expected(256 * 256 * kernel.dst_bytes), actual(expected.size());
+        kernel.scalar(expected.data(), all.data(), 256 * 256);
+        kernel.dispatched(actual.data(), all.data(), 256 * 256);
+        size_t first = 0;
+        while (first < expected.size() && expected[first] == actual[first]) first++;
+        std::string where;
+        if (first < expected.size()) {
+            const size_t pixel = first / kernel.dst_bytes;
+            where = " (first at c=" + std::to_string(all[pixel * 4 + first % kernel.dst_bytes]) +
+                    ", a=" + std::to_string(pixel >> 8) + ": " + std::to_string(actual[first]) + " instead of " +
+                    std::to_string(expected[first]) + ")";
+        }
+        test.check(first == expected.size(), "kernels/" + isa + "/" + kernel.name + ": all pairs" + where);
+    }
+
+    // Lengths around every vector width, at unaligned source and destination offsets
+    std::vector<uint8_t> src(80 * 4 + 3);
+    uint32_t seed = 1;
+    for (uint8_t &byte : src) byte = (uint8_t)((seed = seed * 1664525 + 1013904223) >> 24);
+    for (const Pair &kernel : kernels) {
+        bool matched = true;
+        for (size_t count = 0; count <= 70 && matched; count++) {
+            for (int offset = 0; offset < 4 && matched; offset++) {
+                // A canary past the end catches stores beyond count
+                std::vector<uint8_t> expected(count * kernel.dst_bytes + offset + 32, 0xCD), actual(expected);
+                kernel.scalar(expected.data() + offset, src.data() + offset, count);
+                kernel.dispatched(actual.data() + offset, src.data() + offset, count);
+                matched = expected == actual;
+            }
+        }
+        test.check(matched, "kernels/" + isa + "/" + kernel.name + ": every length and offset");
+    }
+}
+
+static int run_selftest() {
+    SelfTest test;
+    selftest_kernels(test);
+    selftest_tessellator(test);
+    std::printf("selftest: %d checks, %d failed\n", test.checks, test.failures);
+    return test.failures > 0 ? 1 : 0;
+}
+
+/**
+ * A fixed frame to render: a file, optionally a named artboard and state machine, the time to advance to and the
+ * surface size, plus inputs applied on the way. One case per line of the cases file, `#` starts a comment:
+ *
+ *     # name         file          artboard  machine  time  size  steps...
+ *     rocket_boost   rocket.riv    -         -        1.0   256   @0.2:number:speed=3 @0.5:down:128,128 @0.6:up:128,128
+ *
+ * `-` picks the default artboard or state machine. Steps are `@<seconds>:<action>:<argument>`, with the actions
+ * bool:<input>=true|false, number:<input>=<value>, trigger:<input> and down|move|up:<x>,<y> in surface pixels.
+ * Without a cases file, every example gets one case at 1 s and 256 pixels.
+ */
+struct Step {
+    float time = 0;
+    std::string action;
+    std::string argument;
+};
+
+struct Case {
+    std::string name;
+    std::string file;
+    std::string artboard;
+    std::string machine;
+    float time = 1.0f;
+    int size = 256;
+    std::vector<Step> steps;
+};
+
+static bool parse_step(const std::string &text, Step &step) {
+    const size_t first = text.find(':'), second = text.find(':', first + 1);
+    if (text.empty() || text[0] != '@' || first == std::string::npos || second == std::string::npos) return false;
+    step.time = std::atof(text.substr(1, first - 1).c_str());
+    step.action = text.substr(first + 1, second - first - 1);
+    step.argument = text.substr(second + 1);
+    return true;
+}
+
+static std::vector<Case> read_cases(const std::string &path) {
+    std::vector<Case> cases;
+    std::ifstream in(path);
+    int number = 0;
+    for (std::string line; std::getline(in, line);) {
+        number++;
+        line = line.substr(0, line.find('#'));
+        std::istringstream stream(line);
+        Case entry;
+        if (!(stream >> entry.name)) continue;
+        if (!(stream >> entry.file >> entry.artboard >> entry.machine >> entry.time >> entry.size)) {
+            std::fprintf(stderr, "%s:%d: expected name, file, artboard, machine, time and size\n", path.c_str(),
+                         number);
+            continue;
+        }
+        if (entry.artboard == "-") entry.artboard.clear();
+        if (entry.machine == "-") entry.machine.clear();
+        for (std::string text; stream >> text;) {
+            Step step;
+            if (parse_step(text, step)) entry.steps.push_back(step);
+            else std::fprintf(stderr, "%s:%d: bad step %s\n", path.c_str(), number, text.c_str());
+        }
+        std::stable_sort(entry.steps.begin(), entry.steps.end(), [](const Step &a, const Step &b) {
+            return a.time < b.time;
+        });
+        cases.push_back(entry);
+    }
+    return cases;
+}
+
+static void apply_step(const Step &step, Instance &instance, const Raster &raster, const std::string &name) {
+    rive::StateMachineInstance *machine = instance.machine.get();
+    if (!machine) {
+        std::fprintf(stderr, "%s: no state machine for %s, skipped\n", name.c_str(), step.action.c_str());
+        return;
+    }
+    const size_t equals = step.argument.find('=');
+    const std::string input = step.argument.substr(0, equals);
+    const std::string value = equals == std::string::npos ? "" : step.argument.substr(equals + 1);
+    auto position = [&]() {
+        const size_t comma = step.argument.find(',');
+        const float x = std::atof(step.argument.c_str());
+        const float y = comma == std::string::npos ? 0 : std::atof(step.argument.c_str() + comma + 1);
+        return raster.alignment(instance.artboard.get()).invertOrIdentity() * rive::Vec2D(x, y);
+    };
+    bool found = true;
+    if (step.action == "bool") {
+        if (auto bool_input = machine->getBool(input)) bool_input->value(value == "true" || value == "1");
+        else found = false;
+    } else if (step.action == "number") {
+        if (auto number_input = machine->getNumber(input)) number_input->value(std::atof(value.c_str()));
+        else found = false;
+    } else if (step.action == "trigger") {
+        if (auto trigger = machine->getTrigger(input)) trigger->fire();
+        else found = false;
+    } else if (step.action == "down") {
+        machine->pointerDown(position());
+    } else if (step.action == "move") {
+        machine->pointerMove(position());
+    } else if (step.action == "up") {
+        machine->pointerUp(position());
+    } else {
+        std::fprintf(stderr, "%s: unknown action %s\n", name.c_str(), step.action.c_str());
+    }
+    if (!found) std::fprintf(stderr, "%s: no input named %s\n", name.c_str(), input.c_str());
+}
+
+/* Pixels whose channels differ by more than the tolerance, as a fraction of the image. */
+static double image_difference(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b, int tolerance) {
+    size_t differing = 0;
+    for (size_t i = 0; i + 3 < a.size(); i += 4) {
+        for (int c = 0; c < 4; c++) {
+            if (std::abs(a[i + c] - b[i + c]) > tolerance) {
+                differing++;
+                break;
+            }
+        }
+    }
+    return a.empty() ? 0 : (double)differing / (a.size() / 4);
+}
+
+/* Renders one case and records or compares its image; returns false if the image didn't match. */
+static bool run_case(const Case &entry, const Options &options, rive::SkiaFactory *factory, Report &report) {
+    const std::vector<uint8_t> bytes = read_bytes(fs::path(options.examples) / entry.file);
+    std::unique_ptr<rive::File> file = import(bytes, factory);
+    if (!file) {
+        std::fprintf(stderr, "%s: could not import %s\n", entry.name.c_str(), entry.file.c_str());
+        return false;
+    }
+    Instance instance(file.get(), entry.artboard, entry.machine);
+    if (!instance.artboard || (!entry.machine.empty() && !instance.machine)) {
+        std::fprintf(stderr, "%s: no artboard or state machine by that name\n", entry.name.c_str());
+        return false;
+    }
+    Raster raster(entry.size);
+    if (!raster.surface) return false;
+    // The static layer bakes draws that stayed unchanged for a while, so it plays along for the last frames
+    Raster layered(entry.size);
+    StaticLayer layer;
+    const bool check_layer = options.golden == "compare" && layered.surface;
+
+    // Advance in fixed steps so the frame only depends on the case, applying each step on the frame it falls in
+    const int frames = (int)std::lround(entry.time / BENCH_DELTA);
+    size_t next = 0;
+    for (int frame = 0; frame <= frames; frame++) {
+        while (next < entry.steps.size() && entry.steps[next].time <= frame * BENCH_DELTA + BENCH_DELTA / 2)
+            apply_step(entry.steps[next++], instance, raster, entry.name);
+        instance.advance(frame < frames ? BENCH_DELTA : 0.0f);
+        if (check_layer && frame >= frames - STATIC_LAYER_MIN_FRAMES * 2)
+            layer.draw(layered.surface.get(), layered.record(instance.artboard.get()));
+    }
+    if (check_layer) {
+        // Holding the final frame bakes everything in it, so the cached image itself is compared too
+        const sk_sp<SkPicture> picture = layered.record(instance.artboard.get());
+        for (int i = 0; i <= STATIC_LAYER_MIN_FRAMES; i++) layer.draw(layered.surface.get(), picture);
+        layered.copy();
+    }
+
+    std::vector<double> raster_ms;
+    for (int i = 0; i < options.frames; i++) {
+        auto start = Clock::now();
+        raster.draw(instance.artboard.get());
+        raster_ms.push_back(elapsed_ms(start));
+    }
+    report.add("golden/" + entry.name + "/raster_ms", median(raster_ms));
+    raster.copy();
+
+    const std::string golden = (fs::path(options.golden_dir) / (entry.name + ".png")).string();
+    if (options.golden == "record") {
+        if (!png::write_png(golden, raster.pixels.data(), entry.size, entry.size)) {
+            std::fprintf(stderr, "%s: could not write %s\n", entry.name.c_str(), golden.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool matched = true;
+    const std::string layered_png = (fs::path(options.golden_dir) / (entry.name + ".static.png")).string();
+    if (check_layer) {
+        const double difference = image_difference(layered.pixels, raster.pixels, options.tolerance);
+        if (difference > options.max_diff) {
+            std::printf("STATIC     %-48s %.3f%% of pixels differ with %d draw(s) cached\n", entry.name.c_str(),
+                        difference * 100, layer.get_cached_ops());
+            png::write_png(layered_png, layered.pixels.data(), entry.size, entry.size);
+            matched = false;
+        } else {
+            fs::remove(layered_png);
+        }
+    }
+
+    std::vector<uint8_t> expected;
+    int width, height;
+    const std::string actual = (fs::path(options.golden_dir) / (entry.name + ".actual.png")).string();
+    if (!png::read_png(golden, expected, width, height)) {
+        std::printf("MISSING    %-48s no golden image, record it with --golden record\n", entry.name.c_str());
+    } else if (width != entry.size || height != entry.size) {
+        std::printf("MISMATCH   %-48s golden is %dx%d, case renders %dx%d\n", entry.name.c_str(), width, height,
+                    entry.size, entry.size);
+    } else {
+        const double difference = image_difference(raster.pixels, expected, options.tolerance);
+        if (difference <= options.max_diff) {
+            fs::remove(actual);
+            return matched;
+        }
+        std::printf("MISMATCH   %-48s %.3f%% of pixels differ\n", entry.name.c_str(), difference * 100);
+    }
+    png::write_png(actual, raster.pixels.data(), entry.size, entry.size);
+    return false;
+}
+
+/* Runs every case; returns the number of images that didn't match. */
+static int run_golden(const std::vector<fs::path> &files, const Options &options, rive::SkiaFactory *factory,
+                      Report &report) {
+    std::vector<Case> cases;
+    if (!options.cases.empty()) {
+        cases = read_cases(options.cases);
+    } else {
+        for (auto &path : files) {
+            Case entry;
+            entry.name = path.stem().string();
+            entry.file = path.filename().string();
+            cases.push_back(entry);
+        }
+    }
+    if (options.golden == "record") fs::create_directories(options.golden_dir);
+
+    int failures = 0;
+    for (auto &entry : cases)
+        if (!run_case(entry, options, factory, report)) failures++;
+    std::printf("%d of %d case(s) %s\n", (int)cases.size() - failures, (int)cases.size(),
+                options.golden == "record" ? "recorded" : "match");
+    return failures;
+}
+
+static std::string to_json(const Report &report, const Options &options) {
+    std::ostringstream json;
+    json << "{\n  \"isa\": \"" << pixel_kernels::isa() << "\",\n  \"frames\": " << options.frames
+         << ",\n  \"peak_memory_kb\": " << peak_memory_kb() << ",\n  \"metrics\": {\n";
+    for (size_t i = 0; i < report.metrics.size(); i++) {
+        char value[32];
+        std::snprintf(value, sizeof(value), "%.4f", report.metrics[i].second);
+        const char *separator = i + 1 < report.metrics.size() ? ",\n" : "\n";
+        json << "    \"" << report.metrics[i].first << "\": " << value << separator;
+    }
+    json << "  }\n}\n";
+    return json.str();
+}
+
+/* Reads the metrics of a report written by to_json(). */
+static std::map<std::string, double> read_metrics(const std::string &path) {
+    std::map<std::string, double> metrics;
+    std::ifstream in(path);
+    const std::regex line_pattern("^\\s*\"([^\"]+)\": (-?[0-9.eE+-]+),?\\s*$");
+    bool in_metrics = false;
+    for (std::string line; std::getline(in, line);) {
+        if (line.find("\"metrics\"") != std::string::npos) in_metrics = true;
+        std::smatch match;
+        if (in_metrics && std::regex_match(line, match, line_pattern)) metrics[match[1]] = std::stod(match[2]);
+    }
+    return metrics;
+}
+
+/* Prints metrics that moved by more than the threshold; returns the number of regressions. */
+static int compare(const Report &report, const Options &options) {
+    std::map<std::string, double> baseline = read_metrics(options.baseline);
+    if (baseline.empty()) {
+        std::fprintf(stderr, "No metrics found in baseline <%s>\n", options.baseline.c_str());
+        return 1;
+    }
+    int regressions = 0;
+    for (auto &metric : report.metrics) {
+        auto found = baseline.find(metric.first);
+        if (found == baseline.end() || found->second < BENCH_NOISE_FLOOR_MS) continue;
+        const double change = metric.second / found->second - 1.0;
+        if (change > options.threshold) {
+            regressions++;
+            std::printf("REGRESSED  %-48s %9.4f -> %9.4f ms (%+.0f%%)\n",
+                        metric.first.c_str(), found->second, metric.second, change * 100);
+        } else if (change < -options.threshold) {
+            std::printf("improved   %-48s %9.4f -> %9.4f ms (%+.0f%%)\n",
+                        metric.first.c_str(), found->second, metric.second, change * 100);
+        }
+    }
+    std::printf("%d regression(s) beyond %.0f%% of <%s>\n", regressions, options.threshold * 100,
+                options.baseline.c_str());
+    return regressions;
+}
+
+static std::vector<int> parse_sizes(const std::string &value) {
+    std::vector<int> sizes;
+    std::stringstream stream(value);
+    for (std::string part; std::getline(stream, part, ',');) {
+        int size = std::atoi(part.c_str());
+        if (size > 0) sizes.push_back(size);
+    }
+    return sizes;
+}
+
+static bool parse_options(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        if (arg == "--examples") options.examples = value();
+        else if (arg == "--sizes") options.sizes = parse_sizes(value());
+        else if (arg == "--frames") options.frames = std::max(1, std::atoi(value().c_str()));
+        else if (arg == "--repeat") options.repeat = std::max(1, std::atoi(value().c_str()));
+        else if (arg == "--kernels") options.kernels = true;
+        else if (arg == "--selftest") options.selftest = true;
+        else if (arg == "--out") options.out = value();
+        else if (arg == "--baseline") options.baseline = value();
+        else if (arg == "--threshold") options.threshold = std::atof(value().c_str());
+        else if (arg == "--golden") options.golden = value();
+        else if (arg == "--cases") options.cases = value();
+        else if (arg == "--golden-dir") options.golden_dir = value();
+        else if (arg == "--tolerance") options.tolerance = std::max(0, std::atoi(value().c_str()));
+        else if (arg == "--max-diff") options.max_diff = std::atof(value().c_str());
+        else {
+            std::fprintf(stderr, "Unknown option %s (see the top of bench/rive_bench.cpp)\n", arg.c_str());
+            return false;
+        }
+    }
+    if (!options.golden.empty() && options.golden != "record" && options.golden != "compare") {
+        std::fprintf(stderr, "--golden takes record or compare\n");
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parse_options(argc, argv, options)) return 2;
+    if (options.selftest) return run_selftest();
+
+    std::vector<fs::path> files;
+    if (fs::is_directory(options.examples))
+        for (auto &entry : fs::directory_iterator(options.examples))
+            if (entry.path().extension() == ".riv") files.push_back(entry.path());
+    std::sort(files.begin(), files.end());
+    if (files.empty()) {
+        std::fprintf(stderr, "No .riv files in <%s>\n", options.examples.c_str());
+        return 2;
+    }
+
+    rive::SkiaFactory factory;
+    Report report;
+    int mismatches = 0;
+    if (!options.golden.empty()) {
+        mismatches = run_golden(files, options, &factory, report);
+    } else {
+        for (auto &path : files) bench_file(path, options, &factory, report);
+    }
+    if (options.kernels) bench_kernels(options, report);
+
+    const std::string json = to_json(report, options);
+    if (options.out.empty()) std::fputs(json.c_str(), stdout);
+    else std::ofstream(options.out) << json;
+
+    if (!options.baseline.empty() && compare(report, options) > 0) return 1;
+    return mismatches > 0 ? 1 : 0;
+}
@@ -0,0 +1,31 @@
+extends SceneTree
+
+# Headless bake command, e.g.:
+#   godot --headless --path demo -s res://addons/rive_baker/bake_cli.gd -- \
+#       --riv=res://examples/rocket.riv --animation=0 --size=256x256 --fps=30 --out=res://baked/rocket
+#
+# State machines need a duration and may take a JSON input timeline:
+#   --scene=0 --duration=3 --timeline=res://baked/hover.json
+# where the JSON is an array of { "time": 0.5, "input": "Hover", "value": true }.
+# Use --no-trim / --no-dedupe to keep every frame at full size.
+
+const RiveBakeOptions = preload("res://addons/rive_baker/rive_bake_options.gd")
+
+
+func _initialize():
+	var options := {}
+	for arg in OS.get_cmdline_user_args():
+		if not arg.begins_with("--"):
+			continue
+		var pair: PackedStringArray = arg.substr(2).split("=", true, 1)
+		if pair[0].begins_with("no-"):
+			options[pair[0].substr(3)] = false
+		else:
+			options[pair[0]] = pair[1] if pair.size() > 1 else true
+
+	if not options.has("riv"):
+		printerr("[RiveBaker] Missing --riv=<path>")
+		quit(1)
+		return
+
+	quit(0 if RiveBakeOptions.bake(options) == OK else 1)
@@ -0,0 +1,73 @@
+@tool
+extends EditorPlugin
+
+const RiveBakeOptions = preload("res://addons/rive_baker/rive_bake_options.gd")
+const MENU_ITEM = "Bake Rive Animation..."
+
+var dialog: ConfirmationDialog
+var fields := {}
+
+func _enter_tree():
+	add_tool_menu_item(MENU_ITEM, _open_dialog)
+
+func _exit_tree():
+	remove_tool_menu_item(MENU_ITEM)
+	if dialog:
+		dialog.queue_free()
+
+func _open_dialog():
+	if not dialog:
+		_build_dialog()
+	dialog.popup_centered(Vector2i(420, 0))
+
+func _build_dialog():
+	dialog = ConfirmationDialog.new()
+	dialog.title = "Bake Rive Animation"
+	dialog.ok_button_text = "Bake"
+	dialog.confirmed.connect(_on_bake)
+
+	var grid := GridContainer.new()
+	grid.columns = 2
+	dialog.add_child(grid)
+
+	_add_line(grid, "riv", "res://examples/rocket.riv")
+	_add_number(grid, "artboard", 0, 0)
+	_add_number(grid, "animation", 0, -1)
+	_add_number(grid, "scene", -1, -1)
+	_add_line(grid, "size", "256x256")
+	_add_number(grid, "fps", 30, 1)
+	_add_number(grid, "duration", 0, 0)
+	_add_line(grid, "timeline", "")
+	_add_line(grid, "out", "res://baked/rocket")
+
+	EditorInterface.get_base_control().add_child(dialog)
+
+func _add_line(grid: GridContainer, key: String, value: String):
+	var label := Label.new()
+	label.text = key.capitalize()
+	grid.add_child(label)
+	var edit := LineEdit.new()
+	edit.text = value
+	edit.custom_minimum_size.x = 260
+	grid.add_child(edit)
+	fields[key] = edit
+
+func _add_number(grid: GridContainer, key: String, value: float, min_value: float):
+	var label := Label.new()
+	label.text = key.capitalize()
+	grid.add_child(label)
+	var spin := SpinBox.new()
+	spin.min_value = min_value
+	spin.max_value = 1000
+	spin.step = 0.01 if key == "duration" else 1
+	spin.value = value
+	grid.add_child(spin)
+	fields[key] = spin
+
+func _on_bake():
+	var options := {}
+	for key in fields:
+		var field = fields[key]
+		options[key] = field.text if field is LineEdit else field.value
+	if RiveBakeOptions.bake(options) == OK:
+		EditorInterface.get_resource_filesystem().scan()
@@ -0,0 +1,45 @@
+extends RefCounted
+
+# Shared option handling for the editor dialog and the headless command.
+# Options use the same keys as the command line flags (riv, artboard, animation, scene, size, fps,
+# duration, timeline, out, trim, dedupe, padding).
+
+static func make_baker(options: Dictionary) -> RiveBaker:
+	var baker := RiveBaker.new()
+	baker.file_path = options.get("riv", "")
+	baker.artboard = int(options.get("artboard", 0))
+	baker.animation = int(options.get("animation", 0))
+	baker.scene = int(options.get("scene", -1))
+	baker.fps = float(options.get("fps", 30))
+	baker.duration = float(options.get("duration", 0))
+	baker.trim = options.get("trim", true)
+	baker.deduplicate = options.get("dedupe", true)
+	baker.padding = int(options.get("padding", 1))
+
+	var size = options.get("size", Vector2i(256, 256))
+	if size is String:
+		var parts: PackedStringArray = size.split("x")
+		size = Vector2i(int(parts[0]), int(parts[parts.size() - 1]))
+	baker.size = size
+
+	var timeline = options.get("timeline", [])
+	if timeline is String and not timeline.is_empty():
+		timeline = JSON.parse_string(FileAccess.get_file_as_string(timeline))
+	if timeline is Array:
+		baker.timeline = timeline
+	return baker
+
+
+static func bake(options: Dictionary) -> Error:
+	var out: String = options.get("out", "")
+	if out.is_empty():
+		out = String(options.get("riv", "")).get_basename()
+	DirAccess.make_dir_recursive_absolute(out.get_base_dir())
+
+	var baker := make_baker(options)
+	var err := baker.bake(out)
+	if err == OK:
+		print("[RiveBaker] Wrote %s.png and %s.tres (%d frames, %d unique)" % [
+			out, out, baker.get_frame_count(), baker.get_unique_frame_count()
+		])
+	return err
@@ -0,0 +1,14 @@
+@tool
+extends EditorPlugin
+
+const RiveDebuggerPlugin = preload("res://addons/rive_profiler/rive_debugger_plugin.gd")
+
+var debugger: EditorDebuggerPlugin
+
+func _enter_tree():
+	debugger = RiveDebuggerPlugin.new()
+	add_debugger_plugin(debugger)
+
+func _exit_tree():
+	remove_debugger_plugin(debugger)
+	debugger = null
@@ -0,0 +1,75 @@
+@tool
+extends EditorDebuggerPlugin
+
+# Adds a "Rive" tab to each debugger session. While profiling is on, the game's "rive" profiler sends the
+# top viewers by average frame cost (see RiveProfiler) twice a second; they are listed most expensive first.
+
+const COLUMNS = ["Node", "File", "Cost (ms)", "Advance", "Raster", "Upload", "Rendered", "Skipped", "Surface"]
+
+var tabs := {}
+
+func _has_capture(capture: String) -> bool:
+	return capture == "rive"
+
+func _capture(message: String, data: Array, session_id: int) -> bool:
+	if message != "rive:viewers" or not tabs.has(session_id):
+		return false
+	_show_viewers(tabs[session_id], data)
+	return true
+
+func _setup_session(session_id: int):
+	var tab := VBoxContainer.new()
+	tab.name = "Rive"
+
+	var bar := HBoxContainer.new()
+	tab.add_child(bar)
+	var toggle := CheckButton.new()
+	toggle.text = "Profile viewers"
+	bar.add_child(toggle)
+	var label := Label.new()
+	label.text = "Top"
+	bar.add_child(label)
+	var count := SpinBox.new()
+	count.min_value = 1
+	count.max_value = 100
+	count.value = 10
+	bar.add_child(count)
+
+	var tree := Tree.new()
+	tree.size_flags_vertical = Control.SIZE_EXPAND_FILL
+	tree.hide_root = true
+	tree.columns = COLUMNS.size()
+	tree.column_titles_visible = true
+	for i in COLUMNS.size():
+		tree.set_column_title(i, COLUMNS[i])
+		tree.set_column_expand(i, i < 2)
+	for column in [3, 4, 5]:
+		tree.set_column_title_tooltip_text(column, "Average / p95, in milliseconds")
+	tab.add_child(tree)
+
+	var session := get_session(session_id)
+	var update := func(_value = null):
+		if session.is_active():
+			session.toggle_profiler("rive", toggle.button_pressed, [int(count.value)])
+	toggle.toggled.connect(update)
+	count.value_changed.connect(update)
+	session.started.connect(update)
+	session.stopped.connect(tree.clear)
+	session.add_session_tab(tab)
+	tabs[session_id] = tree
+
+func _show_viewers(tree: Tree, viewers: Array):
+	tree.clear()
+	var root := tree.create_item()
+	for info in viewers:
+		var item := tree.create_item(root)
+		item.set_text(0, str(info.get("node", "")))
+		item.set_text(1, String(info.get("file", "")).get_file())
+		item.set_tooltip_text(1, info.get("file", ""))
+		item.set_text(2, "%.2f" % info.get("cost_ms", 0.0))
+		item.set_text(3, "%.2f / %.2f" % [info.get("advance_ms_avg", 0.0), info.get("advance_ms_p95", 0.0)])
+		item.set_text(4, "%.2f / %.2f" % [info.get("raster_ms_avg", 0.0), info.get("raster_ms_p95", 0.0)])
+		item.set_text(5, "%.2f / %.2f" % [info.get("upload_ms_avg", 0.0), info.get("upload_ms_p95", 0.0)])
+		item.set_text(6, str(info.get("frames_rendered", 0)))
+		item.set_text(7, str(info.get("frames_skipped", 0)))
+		item.set_text(8, "%dx%d" % [info.get("surface_width", 0), info.get("surface_height", 0)])
@@ -0,0 +1,200 @@
+extends Node
+
+## Headless stress test for the viewers. Spawns a grid of RiveViewer or RiveViewer2D nodes across the example files,
+## drives them for a number of frames and writes a JSON report of frame time, process time and memory.
+##
+## godot --headless --path demo res://stress/stress_test.tscn -- --rows=8 --cols=8 --mode=hover --kind=2d
+##
+## Options (all optional):
+##   --rows, --cols   grid size (default 8x8)
+##   --kind           control | 2d (default control)
+##   --mode           static | hover | resize (default static)
+##   --size           cell size in pixels (default 128)
+##   --events         pointer events per frame in hover mode (default 32)
+##   --warmup         frames to skip before measuring (default 60)
+##   --frames         frames to measure (default 600)
+##   --out            report path (default user://stress_report.json)
+
+const EXAMPLES_DIR := "res://examples"
+const RIVE_MONITORS := [
+	"Rive/Active Viewers", "Rive/Sleeping Viewers", "Rive/Culled Viewers", "Rive/Load (ms)", "Rive/Advance (ms)",
+	"Rive/Raster (ms)", "Rive/Copy (ms)", "Rive/Upload (ms)", "Rive/Uploaded Bytes", "Rive/Reinstantiations",
+	"Rive/Imported Files", "Rive/Imported File Memory",
+]
+
+var options := {
+	"rows": 8,
+	"cols": 8,
+	"kind": "control",
+	"mode": "static",
+	"size": 128,
+	"events": 32,
+	"warmup": 60,
+	"frames": 600,
+	"out": "user://stress_report.json",
+}
+
+var viewers: Array = []
+var frame := 0
+var last_ticks := 0
+var frame_times: Array[float] = []
+var process_times: Array[float] = []
+var memory_start := 0
+var memory_peak := 0
+var monitor_sums := {}
+var rng := RandomNumberGenerator.new()
+
+
+func _ready():
+	_parse_args()
+	rng.seed = 1
+	var files := _find_files()
+	if files.is_empty():
+		push_error("[StressTest] No .riv files in " + EXAMPLES_DIR)
+		get_tree().quit(1)
+		return
+	_spawn(files)
+	print("[StressTest] %d %s viewers, mode %s, %d + %d frames" % [
+		viewers.size(), options.kind, options.mode, options.warmup, options.frames
+	])
+	last_ticks = Time.get_ticks_usec()
+
+
+func _parse_args():
+	for arg in OS.get_cmdline_user_args():
+		if not arg.begins_with("--") or not "=" in arg:
+			continue
+		var key: String = arg.substr(2).get_slice("=", 0)
+		var value: String = arg.get_slice("=", 1)
+		if not options.has(key):
+			push_warning("[StressTest] Unknown option --" + key)
+			continue
+		options[key] = int(value) if typeof(options[key]) == TYPE_INT else value
+
+
+func _find_files() -> PackedStringArray:
+	var files := PackedStringArray()
+	for file in DirAccess.get_files_at(EXAMPLES_DIR):
+		if file.get_extension() == "riv":
+			files.append(EXAMPLES_DIR.path_join(file))
+	files.sort()
+	return files
+
+
+func _spawn(files: PackedStringArray):
+	var size := Vector2(options.size, options.size)
+	for row in options.rows:
+		for col in options.cols:
+			var viewer: Node = RiveViewer2D.new() if options.kind == "2d" else RiveViewer.new()
+			viewer.size = size
+			viewer.name = "Viewer_%d_%d" % [row, col]
+			viewer.position = Vector2(col, row) * size
+			viewer.file_path = files[(row * options.cols + col) % files.size()]
+			add_child(viewer)
+			viewers.append(viewer)
+	get_viewport().size = Vector2i(size * Vector2(options.cols, options.rows))
+
+
+func _process(_delta):
+	var now := Time.get_ticks_usec()
+	var frame_ms := (now - last_ticks) / 1000.0
+	last_ticks = now
+
+	match options.mode:
+		"hover":
+			_hover_storm()
+		"resize":
+			_resize_storm()
+
+	frame += 1
+	if frame <= options.warmup:
+		memory_start = int(Performance.get_monitor(Performance.MEMORY_STATIC))
+		return
+
+	frame_times.append(frame_ms)
+	process_times.append(Performance.get_monitor(Performance.TIME_PROCESS) * 1000.0)
+	memory_peak = maxi(memory_peak, int(Performance.get_monitor(Performance.MEMORY_STATIC)))
+	for monitor in RIVE_MONITORS:
+		if Performance.has_custom_monitor(monitor):
+			monitor_sums[monitor] = monitor_sums.get(monitor, 0.0) + float(Performance.get_custom_monitor(monitor))
+
+	if frame >= options.warmup + options.frames:
+		_write_report()
+		get_tree().quit()
+
+
+## Moves the pointer across random cells, with a click every 30 frames. RiveViewer2D reads _input, so every 2D viewer
+## sees every event; RiveViewer only gets events over itself.
+func _hover_storm():
+	var bounds := Vector2(options.cols, options.rows) * options.size
+	for i in options.events:
+		var motion := InputEventMouseMotion.new()
+		motion.position = Vector2(rng.randf() * bounds.x, rng.randf() * bounds.y)
+		motion.global_position = motion.position
+		get_viewport().push_input(motion)
+	if frame % 30 == 0:
+		var position := Vector2(rng.randf() * bounds.x, rng.randf() * bounds.y)
+		for pressed in [true, false]:
+			var button := InputEventMouseButton.new()
+			button.button_index = MOUSE_BUTTON_LEFT
+			button.pressed = pressed
+			button.position = position
+			button.global_position = position
+			get_viewport().push_input(button)
+
+
+## Oscillates every viewer between half and full cell size, so each frame resizes the surfaces.
+func _resize_storm():
+	var scale := 0.75 + 0.25 * sin(frame * 0.2)
+	var size := Vector2(options.size, options.size) * scale
+	for viewer in viewers:
+		viewer.size = size.round()
+
+
+func _write_report():
+	var monitors := {}
+	for monitor in monitor_sums:
+		monitors[monitor] = monitor_sums[monitor] / options.frames
+	var report := {
+		"options": options,
+		"viewers": viewers.size(),
+		"files": _find_files().size(),
+		"frame_ms": _summary(frame_times),
+		"process_ms": _summary(process_times),
+		"memory_static_start": memory_start,
+		"memory_static_peak": memory_peak,
+		"memory_static_peak_total": OS.get_static_memory_peak_usage(),
+		"rive_monitors_avg": monitors,
+	}
+	var file := FileAccess.open(options.out, FileAccess.WRITE)
+	if file == null:
+		push_error("[StressTest] Could not write %s: %s" % [options.out, error_string(FileAccess.get_open_error())])
+		get_tree().quit(1)
+		return
+	file.store_string(JSON.stringify(report, "\t"))
+	file.close()
+	print("[StressTest] frame p50 %.2f ms, p95 %.2f ms, p99 %.2f ms" % [
+		report.frame_ms.p50, report.frame_ms.p95, report.frame_ms.p99
+	])
+	print("[StressTest] Report written to " + ProjectSettings.globalize_path(options.out))
+
+
+func _summary(values: Array[float]) -> Dictionary:
+	var sorted := values.duplicate()
+	sorted.sort()
+	var total := 0.0
+	for value in sorted:
+		total += value
+	return {
+		"mean": total / max(sorted.size(), 1),
+		"p50": _percentile(sorted, 0.5),
+		"p95": _percentile(sorted, 0.95),
+		"p99": _percentile(sorted, 0.99),
+		"max": sorted.back() if not sorted.is_empty() else 0.0,
+	}
+
+
+func _percentile(sorted: Array, fraction: float) -> float:
+	if sorted.is_empty():
+		return 0.0
+	return sorted[clampi(int(ceil(fraction * sorted.size())) - 1, 0, sorted.size() - 1)]
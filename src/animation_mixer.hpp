@@ -0,0 +1,148 @@
+#ifndef _RIVEEXTENSION_ANIMATION_MIXER_HPP_
+#define _RIVEEXTENSION_ANIMATION_MIXER_HPP_
+
+// stdlib
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// rive-cpp
+#include <rive/animation/linear_animation.hpp>
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/artboard.hpp>
+
+// extension
+#include "utils/types.hpp"
+
+/**
+ * Extra linear animations layered over whatever the viewer is already playing. Every layer is applied to the same
+ * artboard with its own weight, speed and loop mode, and the artboard is advanced and drawn once.
+ *
+ * Layers own their animation instances, so the same animation can be layered more than once without disturbing the
+ * RiveAnimation returned by get_animation(). Layers are addressed by the id add() returns, which stays valid when
+ * other layers are removed.
+ */
+struct AnimationMixer {
+    struct Layer {
+        int id = -1;
+        int animation = -1;
+        float weight = 1;
+        float speed = 1;
+        int loop_mode = -1;  // -1 keeps the loop mode authored in the file
+        Ptr<rive::LinearAnimationInstance> instance;
+    };
+
+    std::vector<Layer> layers;
+
+    bool empty() const {
+        return layers.empty();
+    }
+
+    int size() const {
+        return layers.size();
+    }
+
+    bool has(int layer) const {
+        return find(layer) != nullptr;
+    }
+
+    int add(int animation, float weight, float speed, int loop_mode) {
+        Layer layer;
+        layer.id = next_id++;
+        layer.animation = animation;
+        layer.weight = std::clamp(weight, 0.0f, 1.0f);
+        layer.speed = speed;
+        layer.loop_mode = loop_mode;
+        layers.push_back(std::move(layer));
+        return layers.back().id;
+    }
+
+    void remove(int layer) {
+        auto found = std::find_if(layers.begin(), layers.end(), [layer](const Layer &l) { return l.id == layer; });
+        if (found != layers.end()) layers.erase(found);
+    }
+
+    void clear() {
+        layers.clear();
+    }
+
+    /* Drops every layer's instance. Must be called before the artboard they point into is destroyed. */
+    void unbind() {
+        bound = nullptr;
+        bound_id = 0;
+        for (Layer &layer : layers) layer.instance.reset();
+    }
+
+    void set_weight(int layer, float weight) {
+        if (Layer *found = find(layer)) found->weight = std::clamp(weight, 0.0f, 1.0f);
+    }
+
+    void set_speed(int layer, float speed) {
+        if (Layer *found = find(layer)) found->speed = speed;
+    }
+
+    void set_loop_mode(int layer, int loop_mode) {
+        Layer *found = find(layer);
+        if (!found) return;
+        found->loop_mode = loop_mode;
+        if (found->instance && loop_mode != -1) found->instance->loopValue(loop_mode);
+    }
+
+    void reset(int layer) {
+        Layer *found = find(layer);
+        if (found && found->instance) found->instance->reset(1);
+    }
+
+    float time(int layer) const {
+        const Layer *found = find(layer);
+        return found && found->instance ? found->instance->time() : -1;
+    }
+
+    /**
+     * Advances and applies every layer on top of the artboard's current pose. Returns true while any layer plays.
+     * artboard_id identifies the artboard instance (the owning RiveArtboard's instance id, which Godot never reuses),
+     * since a reinstantiated artboard can be allocated at the address of the one it replaced.
+     */
+    bool apply(rive::ArtboardInstance *artboard, uint64_t artboard_id, float delta) {
+        if (!artboard) return false;
+        if (artboard != bound || artboard_id != bound_id) {
+            unbind();
+            bound = artboard;
+            bound_id = artboard_id;
+        }
+
+        bool playing = false;
+        for (Layer &layer : layers) {
+            if (!layer.instance) instantiate(layer);
+            if (!layer.instance) continue;
+            playing |= layer.instance->advance(delta * layer.speed);
+            if (layer.weight > 0) layer.instance->apply(layer.weight);
+        }
+        return playing;
+    }
+
+   private:
+    rive::ArtboardInstance *bound = nullptr;
+    uint64_t bound_id = 0;
+    int next_id = 0;
+
+    Layer *find(int layer) {
+        for (Layer &entry : layers)
+            if (entry.id == layer) return &entry;
+        return nullptr;
+    }
+
+    const Layer *find(int layer) const {
+        for (const Layer &entry : layers)
+            if (entry.id == layer) return &entry;
+        return nullptr;
+    }
+
+    void instantiate(Layer &layer) {
+        if (layer.animation < 0 || layer.animation >= bound->animationCount()) return;
+        layer.instance = rivestd::make_unique<rive::LinearAnimationInstance>(bound->animation(layer.animation), bound);
+        if (layer.loop_mode != -1) layer.instance->loopValue(layer.loop_mode);
+    }
+};
+
+#endif
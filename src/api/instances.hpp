@@ -9,6 +9,7 @@
 #include <godot_cpp/variant/typed_array.hpp>
 
 // extension
+#include "rive_stats.hpp"
 #include "utils/memory.hpp"
 #include "utils/types.hpp"
 
@@ -36,9 +37,10 @@ struct Instances {
     }
 
     Ref<Instance> reinstantiate(const int index) {
-        if (instances.count(index)) unref(instances.at(index));
+        // Assign rather than insert; insert() keeps the stale instance when the index already exists
         auto inst = instantiate(index);
-        instances.insert(pair<int, Ref<Instance>>(index, inst));
+        instances[index] = inst;
+        RiveStats::get_singleton().frame().reinstantiations++;
         return inst;
     }
 
@@ -69,6 +69,7 @@ class RiveArtboard : public Resource {
         ClassDB::bind_method(D_METHOD("get_animation_count"), &RiveArtboard::get_animation_count);
         ClassDB::bind_method(D_METHOD("get_animation_names"), &RiveArtboard::get_animation_names);
         ClassDB::bind_method(D_METHOD("get_bounds"), &RiveArtboard::get_bounds);
+        ClassDB::bind_method(D_METHOD("is_opaque"), &RiveArtboard::is_opaque);
         ClassDB::bind_method(D_METHOD("get_scene", "index"), &RiveArtboard::get_scene);
         ClassDB::bind_method(D_METHOD("find_scene", "name"), &RiveArtboard::find_scene);
         ClassDB::bind_method(D_METHOD("get_animation", "index"), &RiveArtboard::get_animation);
@@ -175,6 +176,11 @@ class RiveArtboard : public Resource {
         return Rect2(aabb.left(), aabb.top(), aabb.width(), aabb.height());
     }
 
+    /* True if the artboard's background fills its bounds with solid paint. */
+    bool is_opaque() const {
+        return artboard ? !artboard->isTranslucent() : false;
+    }
+
     Transform2D get_world_transform() const {
         if (artboard) {
             auto trans = artboard->worldTransform().decompose();
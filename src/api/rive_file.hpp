@@ -2,6 +2,7 @@
 #define _RIVEEXTENSION_API_FILE_HPP_
 
 // stdlib
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -27,9 +28,12 @@ class RiveFile : public Resource {
 
     friend class RiveViewerBase;
     friend class RiveInstance;
+    friend class RiveMultiInstance2D;
+    friend class RiveInstancePool;
 
    private:
-    Ptr<rive::File> file;
+    // Shared so pooled wrappers can reuse a single import
+    std::shared_ptr<rive::File> file;
     String path = "";
 
     Instances<RiveArtboard> artboards = Instances<RiveArtboard>([this](int index) -> Ref<RiveArtboard> {
@@ -75,16 +79,20 @@ class RiveFile : public Resource {
 
    public:
     static Ref<RiveFile> MakeRef(Ptr<rive::File> file_value, String path_value) {
+        return MakeRef(std::shared_ptr<rive::File>(std::move(file_value)), path_value);
+    }
+
+    static Ref<RiveFile> MakeRef(std::shared_ptr<rive::File> file_value, String path_value) {
         if (!file_value) return nullptr;
         Ref<RiveFile> obj = memnew(RiveFile);
-        obj->file = std::move(file_value);
+        obj->file = file_value;
         obj->path = path_value;
         return obj;
     }
 
     static Ref<RiveFile> Load(String path, rive::Factory *factory) {
         try {
-            Ptr<rive::File> file = read_rive_file(path, factory);
+            std::shared_ptr<rive::File> file = read_rive_file(path, factory);
             if (file != nullptr) {
                 auto file_wrapper = RiveFile::MakeRef(std::move(file), path);
                 // Successfully imported file
@@ -0,0 +1,197 @@
+#ifndef _RIVEEXTENSION_ARTBOARD_COMPOSER_HPP_
+#define _RIVEEXTENSION_ARTBOARD_COMPOSER_HPP_
+
+// stdlib
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// rive-cpp
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/renderer.hpp>
+
+// extension
+#include "utils/types.hpp"
+#include "viewer_props.hpp"
+
+/**
+ * An ordered list of extra artboards drawn into the viewer's surface after its own artboard. Each entry is placed in
+ * a rect of the viewer with its own fit and alignment, and plays its first state machine (or first animation).
+ * Everything is rasterized in the viewer's single redraw, so a composed panel costs one texture and one upload.
+ *
+ * Entries are addressed by the id add() returns, which stays valid when other entries are removed. Draw order is a
+ * separate property: entries draw by ascending order, and entries with equal order draw in the order they were added.
+ */
+struct ArtboardComposer {
+    struct Entry {
+        int id = -1;
+        int order = 0;
+        int artboard = -1;
+        godot::Rect2 rect;
+        FIT fit = FIT::CONTAIN;
+        ALIGN alignment = ALIGN::CENTER;
+        rive::Mat2D transform;
+        Ptr<rive::ArtboardInstance> instance;
+        Ptr<rive::StateMachineInstance> machine;
+        Ptr<rive::LinearAnimationInstance> animation;
+
+        void update_transform() {
+            if (!instance) return;
+            rive::AABB frame(
+                rect.position.x, rect.position.y, rect.position.x + rect.size.x, rect.position.y + rect.size.y
+            );
+            transform = rive::computeAlignment(convert(fit), convert(alignment), frame, instance->bounds());
+        }
+    };
+
+    std::vector<Entry> entries;
+
+    bool empty() const {
+        return entries.empty();
+    }
+
+    int size() const {
+        return entries.size();
+    }
+
+    bool has(int id) const {
+        return find(id) != nullptr;
+    }
+
+    /* Returns the id of the new entry, or -1 if the artboard could not be instantiated. */
+    int add(rive::File *file, int artboard, godot::Rect2 rect, FIT fit, ALIGN alignment, int order = 0) {
+        if (!file || artboard < 0 || artboard >= file->artboardCount()) return -1;
+        Entry entry;
+        entry.order = order;
+        entry.artboard = artboard;
+        entry.rect = rect;
+        entry.fit = fit;
+        entry.alignment = alignment;
+        entry.instance = file->artboardAt(artboard);
+        if (!entry.instance) return -1;
+        if (entry.instance->stateMachineCount() > 0) entry.machine = entry.instance->stateMachineAt(0);
+        else if (entry.instance->animationCount() > 0) entry.animation = entry.instance->animationAt(0);
+        entry.instance->advance(0);
+        entry.update_transform();
+        entry.id = next_id++;
+        // After every entry of the same order, so equal orders keep insertion order
+        auto at = std::upper_bound(entries.begin(), entries.end(), order, [](int order, const Entry &e) {
+            return order < e.order;
+        });
+        return entries.insert(at, std::move(entry))->id;
+    }
+
+    void remove(int id) {
+        auto found = std::find_if(entries.begin(), entries.end(), [id](const Entry &e) { return e.id == id; });
+        if (found == entries.end()) return;
+        // Scenes point into their artboard, so release them first
+        found->machine.reset();
+        found->animation.reset();
+        entries.erase(found);
+    }
+
+    void clear() {
+        for (Entry &entry : entries) {
+            entry.machine.reset();
+            entry.animation.reset();
+        }
+        entries.clear();
+    }
+
+    void set_order(int id, int order) {
+        Entry *found = find(id);
+        if (!found || found->order == order) return;
+        found->order = order;
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+            return a.order < b.order;
+        });
+    }
+
+    int get_order(int id) const {
+        const Entry *found = find(id);
+        return found ? found->order : 0;
+    }
+
+    void set_rect(int id, godot::Rect2 rect) {
+        Entry *found = find(id);
+        if (!found) return;
+        found->rect = rect;
+        found->update_transform();
+    }
+
+    void set_fit(int id, FIT fit) {
+        Entry *found = find(id);
+        if (!found) return;
+        found->fit = fit;
+        found->update_transform();
+    }
+
+    void set_alignment(int id, ALIGN alignment) {
+        Entry *found = find(id);
+        if (!found) return;
+        found->alignment = alignment;
+        found->update_transform();
+    }
+
+    void set_input(int id, godot::String name, godot::Variant value) {
+        Entry *found = find(id);
+        if (!found || !found->machine) return;
+        auto &machine = found->machine;
+        std::string input = name.utf8().get_data();
+        if (value.get_type() == godot::Variant::BOOL) {
+            if (auto bool_input = machine->getBool(input)) bool_input->value((bool)value);
+        } else if (auto number_input = machine->getNumber(input)) {
+            number_input->value((float)value);
+        }
+    }
+
+    void fire_trigger(int id, godot::String name) {
+        Entry *found = find(id);
+        if (!found || !found->machine) return;
+        if (auto trigger = found->machine->getTrigger(name.utf8().get_data())) trigger->fire();
+    }
+
+    /* Returns true if any entry changed. */
+    bool advance(float delta) {
+        bool changed = false;
+        for (Entry &entry : entries) {
+            if (entry.machine) changed |= entry.machine->advanceAndApply(delta);
+            else if (entry.animation) changed |= entry.animation->advanceAndApply(delta);
+            else changed |= entry.instance->advance(delta);
+        }
+        return changed;
+    }
+
+    /* Draws every entry by ascending order. The renderer is expected to be in surface (untransformed) space. */
+    void draw(rive::Renderer *renderer) {
+        for (Entry &entry : entries) {
+            renderer->save();
+            renderer->transform(entry.transform);
+            entry.instance->draw(renderer);
+            renderer->restore();
+        }
+    }
+
+   private:
+    int next_id = 0;
+
+    Entry *find(int id) {
+        for (Entry &entry : entries)
+            if (entry.id == id) return &entry;
+        return nullptr;
+    }
+
+    const Entry *find(int id) const {
+        for (const Entry &entry : entries)
+            if (entry.id == id) return &entry;
+        return nullptr;
+    }
+};
+
+#endif
@@ -0,0 +1,361 @@
+#include "canvas_factory.h"
+
+// stdlib
+#include <cstring>
+
+// godot-cpp
+#include <godot_cpp/classes/image.hpp>
+
+// rive-cpp
+#include <rive/command_path.hpp>
+
+// extension
+#include "rive_exceptions.hpp"
+
+static const int GRADIENT_RAMP_SIZE = 256;
+static const int GRADIENT_RADIAL_SIZE = 128;
+static const size_t GRADIENT_CACHE_LIMIT = 256;
+
+static Color to_color(rive::ColorInt value) {
+    return Color(
+        ((value >> 16) & 0xFF) / 255.0f,
+        ((value >> 8) & 0xFF) / 255.0f,
+        (value & 0xFF) / 255.0f,
+        ((value >> 24) & 0xFF) / 255.0f
+    );
+}
+
+/* CanvasRenderPath */
+
+CanvasRenderPath::CanvasRenderPath(rive::RawPath &raw, rive::FillRule fill_rule) {
+    fillRule(fill_rule);
+    auto raw_points = raw.points();
+    size_t cursor = 0;
+    for (rive::PathVerb verb : raw.verbs()) {
+        switch (verb) {
+            case rive::PathVerb::move:
+                verbs.push_back(Verb::MOVE);
+                points.push_back(Vector2(raw_points[cursor].x, raw_points[cursor].y));
+                cursor += 1;
+                break;
+            case rive::PathVerb::line:
+                verbs.push_back(Verb::LINE);
+                points.push_back(Vector2(raw_points[cursor].x, raw_points[cursor].y));
+                cursor += 1;
+                break;
+            case rive::PathVerb::quad:
+                verbs.push_back(Verb::QUAD);
+                for (int i = 0; i < 2; i++, cursor++)
+                    points.push_back(Vector2(raw_points[cursor].x, raw_points[cursor].y));
+                break;
+            case rive::PathVerb::cubic:
+                verbs.push_back(Verb::CUBIC);
+                for (int i = 0; i < 3; i++, cursor++)
+                    points.push_back(Vector2(raw_points[cursor].x, raw_points[cursor].y));
+                break;
+            case rive::PathVerb::close:
+                verbs.push_back(Verb::CLOSE);
+                break;
+        }
+    }
+}
+
+void CanvasRenderPath::rewind() {
+    verbs.clear();
+    points.clear();
+    version++;
+}
+
+void CanvasRenderPath::fillRule(rive::FillRule value) {
+    auto next = value == rive::FillRule::evenOdd ? tessellator::FillRule::EVEN_ODD : tessellator::FillRule::NON_ZERO;
+    if (next == rule) return;
+    rule = next;
+    version++;
+}
+
+void CanvasRenderPath::addPath(rive::CommandPath *path, const rive::Mat2D &transform) {
+    addRenderPath(path->renderPath(), transform);
+}
+
+void CanvasRenderPath::addRenderPath(rive::RenderPath *path, const rive::Mat2D &transform) {
+    // Every path in a file comes from the same factory
+    auto other = static_cast<CanvasRenderPath *>(path);
+    const Transform2D xform = to_transform2d(transform);
+    verbs.insert(verbs.end(), other->verbs.begin(), other->verbs.end());
+    for (const Vector2 &point : other->points) points.push_back(xform.xform(point));
+    version++;
+}
+
+void CanvasRenderPath::moveTo(float x, float y) {
+    verbs.push_back(Verb::MOVE);
+    points.push_back(Vector2(x, y));
+    version++;
+}
+
+void CanvasRenderPath::lineTo(float x, float y) {
+    verbs.push_back(Verb::LINE);
+    points.push_back(Vector2(x, y));
+    version++;
+}
+
+void CanvasRenderPath::cubicTo(float ox, float oy, float ix, float iy, float x, float y) {
+    verbs.push_back(Verb::CUBIC);
+    points.push_back(Vector2(ox, oy));
+    points.push_back(Vector2(ix, iy));
+    points.push_back(Vector2(x, y));
+    version++;
+}
+
+void CanvasRenderPath::close() {
+    verbs.push_back(Verb::CLOSE);
+    version++;
+}
+
+std::vector<tessellator::Polyline> CanvasRenderPath::flatten(float tolerance) const {
+    std::vector<tessellator::Polyline> lines;
+    size_t cursor = 0;
+    Vector2 start, current;
+    for (Verb verb : verbs) {
+        switch (verb) {
+            case Verb::MOVE:
+                current = start = points[cursor++];
+                lines.push_back({ { current }, false });
+                break;
+            case Verb::LINE:
+                if (lines.empty()) lines.push_back({ { current }, false });
+                current = points[cursor++];
+                lines.back().points.push_back(current);
+                break;
+            case Verb::QUAD:
+                if (lines.empty()) lines.push_back({ { current }, false });
+                tessellator::flatten_quad(lines.back().points, current, points[cursor], points[cursor + 1], tolerance);
+                current = points[cursor + 1];
+                cursor += 2;
+                break;
+            case Verb::CUBIC:
+                if (lines.empty()) lines.push_back({ { current }, false });
+                tessellator::flatten_cubic(
+                    lines.back().points, current, points[cursor], points[cursor + 1], points[cursor + 2], tolerance
+                );
+                current = points[cursor + 2];
+                cursor += 3;
+                break;
+            case Verb::CLOSE:
+                if (!lines.empty()) lines.back().closed = true;
+                // Drawing after a close continues from the contour's start
+                current = start;
+                lines.push_back({ { current }, false });
+                break;
+        }
+    }
+    // Bare moves carry no geometry; zero-length segments still have two points and keep their caps
+    lines.erase(
+        std::remove_if(lines.begin(), lines.end(), [](const tessellator::Polyline &line) {
+            return line.points.size() < 2;
+        }),
+        lines.end()
+    );
+    return lines;
+}
+
+std::shared_ptr<Tessellation> CanvasRenderPath::get_fill(float tolerance) {
+    if (!fill_cache.tessellation || fill_cache.version != version || fill_cache.tolerance != tolerance) {
+        fill_cache.tessellation = std::make_shared<Tessellation>(tessellator::fill(flatten(tolerance), rule));
+        fill_cache.version = version;
+        fill_cache.tolerance = tolerance;
+    }
+    return fill_cache.tessellation;
+}
+
+std::shared_ptr<Tessellation> CanvasRenderPath::get_stroke(
+    float tolerance, float thickness, tessellator::Join join, tessellator::Cap cap
+) {
+    StrokeCache &cache = stroke_cache;
+    if (!cache.tessellation || cache.version != version || cache.tolerance != tolerance ||
+        cache.thickness != thickness || cache.join != join || cache.cap != cap) {
+        cache.tessellation =
+            std::make_shared<Tessellation>(tessellator::stroke(flatten(tolerance), thickness, join, cap, tolerance));
+        cache.version = version;
+        cache.tolerance = tolerance;
+        cache.thickness = thickness;
+        cache.join = join;
+        cache.cap = cap;
+    }
+    return cache.tessellation;
+}
+
+/* CanvasRenderPaint */
+
+void CanvasRenderPaint::style(rive::RenderPaintStyle value) {
+    stroked = value == rive::RenderPaintStyle::stroke;
+}
+
+void CanvasRenderPaint::color(rive::ColorInt value) {
+    paint_color = to_color(value);
+}
+
+void CanvasRenderPaint::thickness(float value) {
+    stroke_thickness = value;
+}
+
+void CanvasRenderPaint::join(rive::StrokeJoin value) {
+    switch (value) {
+        case rive::StrokeJoin::round:
+            stroke_join = tessellator::Join::ROUND;
+            break;
+        case rive::StrokeJoin::bevel:
+            stroke_join = tessellator::Join::BEVEL;
+            break;
+        default:
+            stroke_join = tessellator::Join::MITER;
+    }
+}
+
+void CanvasRenderPaint::cap(rive::StrokeCap value) {
+    switch (value) {
+        case rive::StrokeCap::round:
+            stroke_cap = tessellator::Cap::ROUND;
+            break;
+        case rive::StrokeCap::square:
+            stroke_cap = tessellator::Cap::SQUARE;
+            break;
+        default:
+            stroke_cap = tessellator::Cap::BUTT;
+    }
+}
+
+void CanvasRenderPaint::blendMode(rive::BlendMode value) {
+    // Canvas items only blend with source-over; other modes draw as normal
+}
+
+void CanvasRenderPaint::shader(rive::rcp<rive::RenderShader> value) {
+    gradient = rive::ref_rcp(static_cast<CanvasRenderShader *>(value.get()));
+}
+
+void CanvasRenderPaint::invalidateStroke() {
+    // Stroke tessellations are keyed on their parameters in the path cache
+}
+
+/* CanvasRenderImage */
+
+CanvasRenderImage::CanvasRenderImage(Ref<ImageTexture> texture_value) {
+    texture = texture_value;
+    m_Width = texture->get_width();
+    m_Height = texture->get_height();
+}
+
+/* CanvasRenderBuffer */
+
+CanvasRenderBuffer::CanvasRenderBuffer(rive::RenderBufferType type, rive::RenderBufferFlags flags, size_t size) :
+        rive::RenderBuffer(type, flags, size), bytes(size) {}
+
+void *CanvasRenderBuffer::onMap() {
+    return bytes.data();
+}
+
+void CanvasRenderBuffer::onUnmap() {}
+
+/* CanvasFactory */
+
+Ref<ImageTexture> CanvasFactory::gradient_texture(
+    bool radial, const rive::ColorInt colors[], const float stops[], size_t count
+) {
+    // FNV-1a over the ramp definition; animated gradients hit the same few ramps repeatedly
+    uint64_t key = 14695981039346656037ULL ^ (radial ? 1 : 0);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t stop_bits;
+        memcpy(&stop_bits, &stops[i], sizeof(stop_bits));
+        key = (key ^ colors[i]) * 1099511628211ULL;
+        key = (key ^ stop_bits) * 1099511628211ULL;
+    }
+    auto found = gradients.find(key);
+    if (found != gradients.end()) return found->second;
+
+    auto sample = [&](float t) {
+        if (count == 0) return Color();
+        if (t <= stops[0]) return to_color(colors[0]);
+        for (size_t i = 1; i < count; i++) {
+            if (t <= stops[i]) {
+                const float span = stops[i] - stops[i - 1];
+                const float weight = span > 0 ? (t - stops[i - 1]) / span : 1;
+                return to_color(colors[i - 1]).lerp(to_color(colors[i]), weight);
+            }
+        }
+        return to_color(colors[count - 1]);
+    };
+
+    const int w = radial ? GRADIENT_RADIAL_SIZE : GRADIENT_RAMP_SIZE, h = radial ? GRADIENT_RADIAL_SIZE : 1;
+    Ref<Image> image = Image::create(w, h, false, Image::FORMAT_RGBA8);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            float t = (x + 0.5f) / w;
+            if (radial) t = Vector2(t - 0.5f, (y + 0.5f) / h - 0.5f).length() * 2;
+            image->set_pixel(x, y, sample(t));
+        }
+    }
+
+    if (gradients.size() >= GRADIENT_CACHE_LIMIT) gradients.clear();
+    Ref<ImageTexture> texture = ImageTexture::create_from_image(image);
+    gradients[key] = texture;
+    return texture;
+}
+
+rive::rcp<rive::RenderBuffer> CanvasFactory::makeRenderBuffer(
+    rive::RenderBufferType type, rive::RenderBufferFlags flags, size_t size
+) {
+    return rive::make_rcp<CanvasRenderBuffer>(type, flags, size);
+}
+
+rive::rcp<rive::RenderShader> CanvasFactory::makeLinearGradient(
+    float sx, float sy, float ex, float ey, const rive::ColorInt colors[], const float stops[], size_t count
+) {
+    auto shader = rive::make_rcp<CanvasRenderShader>();
+    shader->texture = gradient_texture(false, colors, stops, count);
+    const Vector2 start(sx, sy), delta = Vector2(ex, ey) - start;
+    const float length_squared = std::max(delta.length_squared(), 1e-6f);
+    // u is the projection onto the gradient axis; v samples the middle of the 1px ramp
+    shader->uv_transform = Transform2D(
+        delta.x / length_squared, 0, delta.y / length_squared, 0, -start.dot(delta) / length_squared, 0.5f
+    );
+    return shader;
+}
+
+rive::rcp<rive::RenderShader> CanvasFactory::makeRadialGradient(
+    float cx, float cy, float radius, const rive::ColorInt colors[], const float stops[], size_t count
+) {
+    auto shader = rive::make_rcp<CanvasRenderShader>();
+    shader->texture = gradient_texture(true, colors, stops, count);
+    const float scale = 1 / (2 * std::max(radius, 1e-6f));
+    shader->uv_transform = Transform2D(scale, 0, 0, scale, 0.5f - cx * scale, 0.5f - cy * scale);
+    return shader;
+}
+
+rive::rcp<rive::RenderPath> CanvasFactory::makeRenderPath(rive::RawPath &raw, rive::FillRule rule) {
+    return rive::make_rcp<CanvasRenderPath>(raw, rule);
+}
+
+rive::rcp<rive::RenderPath> CanvasFactory::makeEmptyRenderPath() {
+    return rive::make_rcp<CanvasRenderPath>();
+}
+
+rive::rcp<rive::RenderPaint> CanvasFactory::makeRenderPaint() {
+    return rive::make_rcp<CanvasRenderPaint>();
+}
+
+rive::rcp<rive::RenderImage> CanvasFactory::decodeImage(rive::Span<const uint8_t> bytes) {
+    PackedByteArray buffer;
+    buffer.resize(bytes.size());
+    memcpy(buffer.ptrw(), bytes.data(), bytes.size());
+
+    Ref<Image> image;
+    image.instantiate();
+    Error error = ERR_FILE_UNRECOGNIZED;
+    if (bytes.size() > 4 && bytes[0] == 0x89 && bytes[1] == 'P') error = image->load_png_from_buffer(buffer);
+    else if (bytes.size() > 3 && bytes[0] == 0xFF && bytes[1] == 0xD8) error = image->load_jpg_from_buffer(buffer);
+    else if (bytes.size() > 12 && bytes[8] == 'W' && bytes[9] == 'E') error = image->load_webp_from_buffer(buffer);
+    if (error != OK) {
+        RiveException("Unable to decode embedded image.").from("CanvasFactory", "decodeImage").report();
+        return nullptr;
+    }
+    return rive::make_rcp<CanvasRenderImage>(ImageTexture::create_from_image(image));
+}
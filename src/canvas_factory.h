@@ -0,0 +1,167 @@
+#ifndef RIVEEXTENSION_CANVAS_FACTORY_H
+#define RIVEEXTENSION_CANVAS_FACTORY_H
+
+// stdlib
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// rive-cpp
+#include <rive/factory.hpp>
+#include <rive/math/mat2d.hpp>
+#include <rive/math/raw_path.hpp>
+#include <rive/renderer.hpp>
+
+// extension
+#include "utils/tessellator.hpp"
+
+using namespace godot;
+
+static Transform2D to_transform2d(const rive::Mat2D &mat) {
+    return Transform2D(mat.xx(), mat.xy(), mat.yx(), mat.yy(), mat.tx(), mat.ty());
+}
+
+/**
+ * A path recorded as plain commands. Tessellations are cached per path and rebuilt only when the commands change
+ * or the flattening tolerance (driven by the on-screen scale) moves to another power of two.
+ */
+class CanvasRenderPath : public rive::RenderPath {
+   public:
+    enum class Verb { MOVE, LINE, QUAD, CUBIC, CLOSE };
+
+   private:
+    std::vector<Verb> verbs;
+    std::vector<Vector2> points;
+    tessellator::FillRule rule = tessellator::FillRule::NON_ZERO;
+    uint32_t version = 0;
+
+    struct FillCache {
+        std::shared_ptr<Tessellation> tessellation;
+        uint32_t version = UINT32_MAX;
+        float tolerance = 0;
+    } fill_cache;
+
+    struct StrokeCache {
+        std::shared_ptr<Tessellation> tessellation;
+        uint32_t version = UINT32_MAX;
+        float tolerance = 0, thickness = 0;
+        tessellator::Join join = tessellator::Join::MITER;
+        tessellator::Cap cap = tessellator::Cap::BUTT;
+    } stroke_cache;
+
+    std::vector<tessellator::Polyline> flatten(float tolerance) const;
+
+   public:
+    CanvasRenderPath() {}
+    CanvasRenderPath(rive::RawPath &raw, rive::FillRule fill_rule);
+
+    void rewind() override;
+    void fillRule(rive::FillRule value) override;
+    void addPath(rive::CommandPath *path, const rive::Mat2D &transform) override;
+    void addRenderPath(rive::RenderPath *path, const rive::Mat2D &transform) override;
+    void moveTo(float x, float y) override;
+    void lineTo(float x, float y) override;
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override;
+    void close() override;
+
+    std::shared_ptr<Tessellation> get_fill(float tolerance);
+    std::shared_ptr<Tessellation> get_stroke(
+        float tolerance, float thickness, tessellator::Join join, tessellator::Cap cap
+    );
+};
+
+/* Gradients are baked into small textures; the UV mapping is affine, so per-vertex UVs are exact. */
+class CanvasRenderShader : public rive::RenderShader {
+   public:
+    Ref<ImageTexture> texture;
+    Transform2D uv_transform;
+};
+
+class CanvasRenderPaint : public rive::RenderPaint {
+   public:
+    bool stroked = false;
+    Color paint_color = Color(0, 0, 0, 1);
+    float stroke_thickness = 1;
+    tessellator::Join stroke_join = tessellator::Join::MITER;
+    tessellator::Cap stroke_cap = tessellator::Cap::BUTT;
+    rive::rcp<CanvasRenderShader> gradient;
+
+    void style(rive::RenderPaintStyle value) override;
+    void color(rive::ColorInt value) override;
+    void thickness(float value) override;
+    void join(rive::StrokeJoin value) override;
+    void cap(rive::StrokeCap value) override;
+    void blendMode(rive::BlendMode value) override;
+    void shader(rive::rcp<rive::RenderShader> value) override;
+    void invalidateStroke() override;
+};
+
+class CanvasRenderImage : public rive::RenderImage {
+   public:
+    Ref<ImageTexture> texture;
+
+    CanvasRenderImage(Ref<ImageTexture> texture_value);
+};
+
+class CanvasRenderBuffer : public rive::RenderBuffer {
+   private:
+    std::vector<uint8_t> bytes;
+
+   protected:
+    void *onMap() override;
+    void onUnmap() override;
+
+   public:
+    CanvasRenderBuffer(rive::RenderBufferType type, rive::RenderBufferFlags flags, size_t size);
+
+    const uint8_t *data() const {
+        return bytes.data();
+    }
+
+    size_t size() const {
+        return bytes.size();
+    }
+};
+
+/**
+ * Creates render objects for the native canvas backend. Files imported through this factory can only be drawn by a
+ * CanvasRenderer.
+ */
+class CanvasFactory : public rive::Factory {
+   private:
+    std::unordered_map<uint64_t, Ref<ImageTexture>> gradients;
+
+    Ref<ImageTexture> gradient_texture(
+        bool radial, const rive::ColorInt colors[], const float stops[], size_t count
+    );
+
+   public:
+    static CanvasFactory &get_singleton() {
+        static CanvasFactory singleton;
+        return singleton;
+    }
+
+    rive::rcp<rive::RenderBuffer> makeRenderBuffer(
+        rive::RenderBufferType type, rive::RenderBufferFlags flags, size_t size
+    ) override;
+    rive::rcp<rive::RenderShader> makeLinearGradient(
+        float sx, float sy, float ex, float ey, const rive::ColorInt colors[], const float stops[], size_t count
+    ) override;
+    rive::rcp<rive::RenderShader> makeRadialGradient(
+        float cx, float cy, float radius, const rive::ColorInt colors[], const float stops[], size_t count
+    ) override;
+    rive::rcp<rive::RenderPath> makeRenderPath(rive::RawPath &raw, rive::FillRule rule) override;
+    rive::rcp<rive::RenderPath> makeEmptyRenderPath() override;
+    rive::rcp<rive::RenderPaint> makeRenderPaint() override;
+    rive::rcp<rive::RenderImage> decodeImage(rive::Span<const uint8_t> bytes) override;
+
+    void clear() {
+        gradients.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,205 @@
+#include "canvas_renderer.h"
+
+// stdlib
+#include <cmath>
+
+// godot-cpp
+#include <godot_cpp/classes/rendering_server.hpp>
+
+// On-screen flattening error, in pixels
+static const float CANVAS_TOLERANCE = 0.25f;
+
+CanvasRenderer::~CanvasRenderer() {
+    auto rs = RenderingServer::get_singleton();
+    if (!rs) return;
+    for (RID item : items) rs->free_rid(item);
+}
+
+RID CanvasRenderer::acquire_item(RID parent) {
+    auto rs = RenderingServer::get_singleton();
+    if (used == items.size()) items.push_back(rs->canvas_item_create());
+    RID item = items[used++];
+    rs->canvas_item_clear(item);
+    rs->canvas_item_set_parent(item, parent);
+    rs->canvas_item_set_draw_index(item, used);
+    rs->canvas_item_set_canvas_group_mode(item, RenderingServer::CANVAS_GROUP_MODE_DISABLED);
+    return item;
+}
+
+RID CanvasRenderer::target() {
+    if (content.is_valid() && content_clips == state.clips) return content;
+
+    auto rs = RenderingServer::get_singleton();
+    RID parent = root;
+    for (const Clip &clip : state.clips) {
+        RID mask = acquire_item(parent);
+        rs->canvas_item_set_canvas_group_mode(mask, RenderingServer::CANVAS_GROUP_MODE_CLIP_ONLY);
+        rs->canvas_item_add_set_transform(mask, to_transform2d(clip.transform));
+        add_triangles(mask, *clip.mask, Color(1, 1, 1, 1), nullptr);
+        parent = mask;
+    }
+    content = acquire_item(parent);
+    content_clips = state.clips;
+    return content;
+}
+
+float CanvasRenderer::tolerance() const {
+    // Snap to powers of two so cached tessellations survive small scale animations
+    const rive::Mat2D &m = state.transform;
+    const float scale = std::sqrt(std::abs(m.xx() * m.yy() - m.xy() * m.yx()));
+    const float local = CANVAS_TOLERANCE / std::max(scale, 1e-4f);
+    return std::exp2(std::floor(std::log2(local)));
+}
+
+void CanvasRenderer::add_triangles(
+    RID item, const Tessellation &tessellation, Color color, const CanvasRenderShader *shader
+) {
+    if (tessellation.is_empty()) return;
+    PackedColorArray colors;
+    colors.append(color);
+    PackedVector2Array uvs;
+    RID texture;
+    if (shader && shader->texture.is_valid()) {
+        uvs.resize(tessellation.points.size());
+        Vector2 *uv = uvs.ptrw();
+        const Vector2 *point = tessellation.points.ptr();
+        for (int64_t i = 0; i < tessellation.points.size(); i++) uv[i] = shader->uv_transform.xform(point[i]);
+        texture = shader->texture->get_rid();
+    }
+    RenderingServer::get_singleton()->canvas_item_add_triangle_array(
+        item, tessellation.indices, tessellation.points, colors, uvs, PackedInt32Array(), PackedFloat32Array(), texture
+    );
+}
+
+void CanvasRenderer::begin(RID parent) {
+    root = parent;
+    used = 0;
+    content = RID();
+    content_clips.clear();
+    state = State();
+    stack.clear();
+}
+
+void CanvasRenderer::end() {
+    // Items left over from a busier frame are emptied, not freed, since they are likely to be needed again
+    auto rs = RenderingServer::get_singleton();
+    for (size_t i = used; i < items.size(); i++) {
+        rs->canvas_item_clear(items[i]);
+        rs->canvas_item_set_canvas_group_mode(items[i], RenderingServer::CANVAS_GROUP_MODE_DISABLED);
+    }
+}
+
+void CanvasRenderer::clear() {
+    auto rs = RenderingServer::get_singleton();
+    for (RID item : items) rs->free_rid(item);
+    items.clear();
+    used = 0;
+    content = RID();
+    content_clips.clear();
+}
+
+void CanvasRenderer::save() {
+    stack.push_back(state);
+}
+
+void CanvasRenderer::restore() {
+    if (stack.empty()) return;
+    state = stack.back();
+    stack.pop_back();
+}
+
+void CanvasRenderer::transform(const rive::Mat2D &transform) {
+    state.transform = state.transform * transform;
+}
+
+void CanvasRenderer::drawPath(rive::RenderPath *path, rive::RenderPaint *paint) {
+    auto canvas_path = static_cast<CanvasRenderPath *>(path);
+    auto canvas_paint = static_cast<CanvasRenderPaint *>(paint);
+    if (!canvas_path || !canvas_paint) return;
+
+    std::shared_ptr<Tessellation> tessellation = canvas_paint->stroked
+        ? canvas_path->get_stroke(
+              tolerance(), canvas_paint->stroke_thickness, canvas_paint->stroke_join, canvas_paint->stroke_cap
+          )
+        : canvas_path->get_fill(tolerance());
+    if (!tessellation || tessellation->is_empty()) return;
+
+    RID item = target();
+    RenderingServer::get_singleton()->canvas_item_add_set_transform(item, to_transform2d(state.transform));
+    // Rive bakes paint opacity into gradient colors, so gradients draw unmodulated
+    Color color = canvas_paint->gradient ? Color(1, 1, 1, 1) : canvas_paint->paint_color;
+    add_triangles(item, *tessellation, color, canvas_paint->gradient.get());
+}
+
+void CanvasRenderer::clipPath(rive::RenderPath *path) {
+    auto canvas_path = static_cast<CanvasRenderPath *>(path);
+    if (!canvas_path) return;
+    // Nested clip items intersect, matching Rive's clip semantics
+    state.clips.push_back({ canvas_path->get_fill(tolerance()), state.transform });
+}
+
+void CanvasRenderer::drawImage(const rive::RenderImage *image, rive::BlendMode blend_mode, float opacity) {
+    auto canvas_image = static_cast<const CanvasRenderImage *>(image);
+    if (!canvas_image || canvas_image->texture.is_null()) return;
+
+    RID item = target();
+    auto rs = RenderingServer::get_singleton();
+    rs->canvas_item_add_set_transform(item, to_transform2d(state.transform));
+    rs->canvas_item_add_texture_rect(
+        item,
+        Rect2(0, 0, canvas_image->width(), canvas_image->height()),
+        canvas_image->texture->get_rid(),
+        false,
+        Color(1, 1, 1, opacity)
+    );
+}
+
+void CanvasRenderer::drawImageMesh(
+    const rive::RenderImage *image,
+    rive::rcp<rive::RenderBuffer> vertices,
+    rive::rcp<rive::RenderBuffer> uvs,
+    rive::rcp<rive::RenderBuffer> indices,
+    uint32_t vertex_count,
+    uint32_t index_count,
+    rive::BlendMode blend_mode,
+    float opacity
+) {
+    auto canvas_image = static_cast<const CanvasRenderImage *>(image);
+    auto vertex_buffer = static_cast<CanvasRenderBuffer *>(vertices.get());
+    auto uv_buffer = static_cast<CanvasRenderBuffer *>(uvs.get());
+    auto index_buffer = static_cast<CanvasRenderBuffer *>(indices.get());
+    if (!canvas_image || canvas_image->texture.is_null() || !vertex_buffer || !uv_buffer || !index_buffer) return;
+    if (vertex_buffer->size() < vertex_count * 2 * sizeof(float) || uv_buffer->size() < vertex_count * 2 * sizeof(float)
+        || index_buffer->size() < index_count * sizeof(uint16_t))
+        return;
+
+    Tessellation mesh;
+    PackedVector2Array mesh_uvs;
+    mesh.points.resize(vertex_count);
+    mesh_uvs.resize(vertex_count);
+    auto xy = reinterpret_cast<const float *>(vertex_buffer->data());
+    auto uv = reinterpret_cast<const float *>(uv_buffer->data());
+    for (uint32_t i = 0; i < vertex_count; i++) {
+        mesh.points.set(i, Vector2(xy[i * 2], xy[i * 2 + 1]));
+        mesh_uvs.set(i, Vector2(uv[i * 2], uv[i * 2 + 1]));
+    }
+    mesh.indices.resize(index_count);
+    auto index = reinterpret_cast<const uint16_t *>(index_buffer->data());
+    for (uint32_t i = 0; i < index_count; i++) mesh.indices.set(i, index[i]);
+
+    RID item = target();
+    auto rs = RenderingServer::get_singleton();
+    PackedColorArray colors;
+    colors.append(Color(1, 1, 1, opacity));
+    rs->canvas_item_add_set_transform(item, to_transform2d(state.transform));
+    rs->canvas_item_add_triangle_array(
+        item,
+        mesh.indices,
+        mesh.points,
+        colors,
+        mesh_uvs,
+        PackedInt32Array(),
+        PackedFloat32Array(),
+        canvas_image->texture->get_rid()
+    );
+}
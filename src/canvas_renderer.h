@@ -0,0 +1,85 @@
+#ifndef RIVEEXTENSION_CANVAS_RENDERER_H
+#define RIVEEXTENSION_CANVAS_RENDERER_H
+
+// stdlib
+#include <memory>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// rive-cpp
+#include <rive/math/mat2d.hpp>
+#include <rive/renderer.hpp>
+
+// extension
+#include "canvas_factory.h"
+
+using namespace godot;
+
+/**
+ * A rive::Renderer that emits Godot canvas commands instead of pixels. Paths arrive already tessellated (see
+ * CanvasRenderPath) and are submitted with canvas_item_add_triangle_array into canvas items parented to the viewer,
+ * so Godot's renderer rasterizes the vector content and no texture is uploaded.
+ *
+ * Clips become clip-only canvas groups: every change of clip state opens a new chain of items whose masks are the
+ * clip paths, and the draws that follow go into the innermost item. Edges are not antialiased unless the viewport
+ * uses 2D MSAA, and blend modes other than source-over draw as normal.
+ */
+class CanvasRenderer : public rive::Renderer {
+   private:
+    struct Clip {
+        std::shared_ptr<Tessellation> mask;
+        rive::Mat2D transform;
+
+        bool operator==(const Clip &other) const {
+            return mask == other.mask && transform == other.transform;
+        }
+    };
+
+    struct State {
+        rive::Mat2D transform;
+        std::vector<Clip> clips;
+    };
+
+    State state;
+    std::vector<State> stack;
+    RID root;
+    std::vector<RID> items;
+    int used = 0;
+    RID content;
+    std::vector<Clip> content_clips;
+
+    RID acquire_item(RID parent);
+    RID target();
+    float tolerance() const;
+    void add_triangles(RID item, const Tessellation &tessellation, Color color, const CanvasRenderShader *shader);
+
+   public:
+    ~CanvasRenderer();
+
+    /* Starts a frame drawing under the given canvas item. Everything from the previous frame is replaced. */
+    void begin(RID parent);
+    void end();
+    /* Removes everything drawn so far, e.g. when switching back to the raster backend. */
+    void clear();
+
+    void save() override;
+    void restore() override;
+    void transform(const rive::Mat2D &transform) override;
+    void drawPath(rive::RenderPath *path, rive::RenderPaint *paint) override;
+    void clipPath(rive::RenderPath *path) override;
+    void drawImage(const rive::RenderImage *image, rive::BlendMode blend_mode, float opacity) override;
+    void drawImageMesh(
+        const rive::RenderImage *image,
+        rive::rcp<rive::RenderBuffer> vertices,
+        rive::rcp<rive::RenderBuffer> uvs,
+        rive::rcp<rive::RenderBuffer> indices,
+        uint32_t vertex_count,
+        uint32_t index_count,
+        rive::BlendMode blend_mode,
+        float opacity
+    ) override;
+};
+
+#endif
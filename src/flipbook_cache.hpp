@@ -0,0 +1,191 @@
+#ifndef _RIVEEXTENSION_FLIPBOOK_CACHE_HPP_
+#define _RIVEEXTENSION_FLIPBOOK_CACHE_HPP_
+
+// stdlib
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+
+// godot-cpp
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// rive-cpp
+#include <rive/animation/loop.hpp>
+
+// extension
+#include "offscreen_instance.hpp"
+#include "utils/memory.hpp"
+
+using namespace godot;
+
+static const char *FLIPBOOK_BUDGET_SETTING = "rive/flipbook_cache/budget_mb";
+static const int FLIPBOOK_DEFAULT_BUDGET_MB = 64;
+static const int FLIPBOOK_MAX_ATLAS_SIZE = 8192;
+
+/**
+ * A linear animation loop rasterized once into a grid atlas. Playback only changes the region that gets drawn.
+ */
+struct Flipbook {
+    Ref<ImageTexture> atlas;
+    int frame_width = 1;
+    int frame_height = 1;
+    int frame_count = 1;
+    int columns = 1;
+    float fps = 30;
+    float duration = 0;
+    int loop = (int)rive::Loop::loop;
+    size_t bytes = 0;
+    uint64_t last_used = 0;
+
+    int frame_at(float time) const {
+        float t = std::max(time, 0.0f);
+        if (duration > 0) {
+            if (loop == (int)rive::Loop::loop) {
+                t = std::fmod(t, duration);
+            } else if (loop == (int)rive::Loop::pingPong) {
+                t = std::fmod(t, duration * 2);
+                if (t > duration) t = duration * 2 - t;
+            } else {
+                t = std::min(t, duration);
+            }
+        }
+        return std::clamp((int)(t * fps), 0, frame_count - 1);
+    }
+
+    Rect2 region(int frame) const {
+        return Rect2(
+            (frame % columns) * frame_width, (frame / columns) * frame_height, frame_width, frame_height
+        );
+    }
+};
+
+/**
+ * Process-wide LRU of baked flipbooks, keyed by (file, artboard, animation, size, fit, alignment, fps). Viewers hold a
+ * shared reference to the flipbook they play, so evicting an entry only releases it once nobody draws it anymore.
+ */
+class FlipbookCache {
+   private:
+    std::map<String, std::shared_ptr<Flipbook>> entries;
+    size_t usage = 0;
+    uint64_t clock = 0;
+
+    static size_t budget() {
+        auto settings = ProjectSettings::get_singleton();
+        int mb = FLIPBOOK_DEFAULT_BUDGET_MB;
+        if (settings && settings->has_setting(FLIPBOOK_BUDGET_SETTING))
+            mb = settings->get_setting(FLIPBOOK_BUDGET_SETTING);
+        return (size_t)std::max(mb, 0) * 1024 * 1024;
+    }
+
+    void evict(size_t keep_free) {
+        size_t limit = budget();
+        while (!entries.empty() && usage + keep_free > limit) {
+            auto oldest = entries.begin();
+            for (auto it = entries.begin(); it != entries.end(); it++)
+                if (it->second->last_used < oldest->second->last_used) oldest = it;
+            usage -= oldest->second->bytes;
+            entries.erase(oldest);
+        }
+    }
+
+    /* Bakes on the calling thread. Returns null, before rendering any frame, if the atlas would exceed max_bytes. */
+    static std::shared_ptr<Flipbook> bake(
+        String path, int artboard, int animation, int width, int height, FIT fit, ALIGN alignment, float fps,
+        size_t max_bytes
+    ) {
+        if ((size_t)width * height * 4 > max_bytes) return nullptr;
+        OffscreenInstance offscreen;
+        if (!offscreen.load(path, artboard, -1, animation, width, height, fit, alignment)) return nullptr;
+        auto anim = offscreen.animation();
+        if (!exists(anim)) return nullptr;
+
+        auto book = std::make_shared<Flipbook>();
+        book->frame_width = offscreen.width();
+        book->frame_height = offscreen.height();
+        book->fps = fps;
+        book->duration = std::max(anim->get_duration(), 0.0f);
+        book->loop = anim->get_loop_mode();
+        book->frame_count = std::max((int)std::round(book->duration * fps), 1);
+
+        int max_columns = FLIPBOOK_MAX_ATLAS_SIZE / book->frame_width;
+        int max_rows = FLIPBOOK_MAX_ATLAS_SIZE / book->frame_height;
+        book->columns = std::min((int)std::ceil(std::sqrt((float)book->frame_count)), std::max(max_columns, 1));
+        int rows = (book->frame_count + book->columns - 1) / book->columns;
+        if (max_columns < 1 || rows > max_rows) return nullptr;
+
+        const int atlas_width = book->columns * book->frame_width;
+        const int atlas_height = rows * book->frame_height;
+        const size_t frame_row = (size_t)book->frame_width * 4;
+        const size_t atlas_row = (size_t)atlas_width * 4;
+        if (atlas_row * atlas_height > max_bytes) return nullptr;
+
+        PackedByteArray atlas_bytes;
+        atlas_bytes.resize(atlas_row * atlas_height);
+        memset(atlas_bytes.ptrw(), 0, atlas_bytes.size());
+
+        for (int i = 0; i < book->frame_count; i++) {
+            offscreen.advance(i == 0 ? 0 : 1.0f / fps);
+            PackedByteArray frame = offscreen.render();
+            if (frame.size() != frame_row * book->frame_height) return nullptr;
+            Rect2 r = book->region(i);
+            uint8_t *dst = atlas_bytes.ptrw() + (size_t)r.position.y * atlas_row + (size_t)r.position.x * 4;
+            const uint8_t *src = frame.ptr();
+            for (int y = 0; y < book->frame_height; y++) memcpy(dst + y * atlas_row, src + y * frame_row, frame_row);
+        }
+
+        auto image = Image::create_from_data(atlas_width, atlas_height, false, Image::FORMAT_RGBA8, atlas_bytes);
+        book->atlas = ImageTexture::create_from_image(image);
+        book->bytes = atlas_bytes.size();
+        return book;
+    }
+
+   public:
+    static FlipbookCache &get_singleton() {
+        static FlipbookCache singleton;
+        return singleton;
+    }
+
+    /**
+     * Returns the cached flipbook for the key, baking it first if needed. Returns null if it can't be baked, including
+     * when it alone wouldn't fit in the budget, so the viewer renders live instead.
+     */
+    std::shared_ptr<Flipbook> acquire(
+        String path, int artboard, int animation, int width, int height, FIT fit, ALIGN alignment, float fps
+    ) {
+        if (fps <= 0) return nullptr;
+        String key = render_key(path, artboard, animation, width, height, fit, alignment) + "|" + String::num(fps);
+        auto found = entries.find(key);
+        if (found != entries.end()) {
+            found->second->last_used = ++clock;
+            return found->second;
+        }
+
+        auto book = bake(path, artboard, animation, width, height, fit, alignment, fps, budget());
+        if (!book) return nullptr;
+        evict(book->bytes);
+        book->last_used = ++clock;
+        entries[key] = book;
+        usage += book->bytes;
+        return book;
+    }
+
+    size_t get_usage() const {
+        return usage;
+    }
+
+    int get_count() const {
+        return entries.size();
+    }
+
+    void clear() {
+        entries.clear();
+        usage = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef _RIVEEXTENSION_OFFSCREEN_INSTANCE_HPP_
+#define _RIVEEXTENSION_OFFSCREEN_INSTANCE_HPP_
+
+// godot-cpp
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "api/rive_file.hpp"
+#include "rive_instance.hpp"
+#include "skia_instance.hpp"
+#include "utils/memory.hpp"
+#include "viewer_props.hpp"
+
+using namespace godot;
+
+/* Identifies what an offscreen instance renders, so caches and groups can share results. */
+static String render_key(String path, int artboard, int animation, int width, int height, FIT fit, ALIGN alignment) {
+    PackedStringArray parts;
+    parts.append(path);
+    parts.append(String::num_int64(artboard));
+    parts.append(String::num_int64(animation));
+    parts.append(String::num_int64(width));
+    parts.append(String::num_int64(height));
+    parts.append(String::num_int64(fit));
+    parts.append(String::num_int64(alignment));
+    return String("|").join(parts);
+}
+
+/**
+ * A headless viewer: owns its own file, props, rive and skia instances so frames can be rasterized without touching
+ * the state of any on-screen viewer. Used by caches and bakers that render ahead of time.
+ */
+class OffscreenInstance {
+   private:
+    ViewerProps props;
+    RiveInstance inst;
+    SkiaInstance sk;
+
+   public:
+    OffscreenInstance() {
+        inst.set_props(&props);
+        sk.set_props(&props);
+    }
+
+    // Props callbacks capture `this`
+    OffscreenInstance(const OffscreenInstance &) = delete;
+    OffscreenInstance &operator=(const OffscreenInstance &) = delete;
+
+    bool load(
+        String path,
+        int artboard,
+        int scene,
+        int animation,
+        int width,
+        int height,
+        FIT fit = FIT::CONTAIN,
+        ALIGN alignment = ALIGN::CENTER
+    ) {
+        props.path(path);
+        inst.file = RiveFile::Load(path, sk.factory.get());
+        if (!exists(inst.file) || artboard < 0 || artboard >= inst.file->get_artboard_count()) return false;
+        props.artboard(artboard);
+        props.scene(scene);
+        props.animation(animation);
+        props.fit(fit);
+        props.alignment(alignment);
+        inst.instantiate();
+        props.size(width, height);
+        return exists(inst.artboard()) && sk.surface && sk.renderer;
+    }
+
+    /* Switches what plays without importing the file again. */
+    bool select(int artboard, int scene, int animation) {
+        if (!exists(inst.file) || artboard < 0 || artboard >= inst.file->get_artboard_count()) return false;
+        props.artboard(artboard);
+        props.scene(scene);
+        props.animation(animation);
+        inst.instantiate();
+        return exists(inst.artboard());
+    }
+
+    /* Changes only the transform; playback state is kept. */
+    void layout(FIT fit, ALIGN alignment) {
+        props.fit(fit);
+        props.alignment(alignment);
+    }
+
+    bool advance(float delta) {
+        return inst.advance(delta);
+    }
+
+    /* Resizes the surface in place; unlike load(), playback state is kept. */
+    void resize(int width, int height) {
+        props.size(width, height);
+    }
+
+    void press_mouse(Vector2 position) {
+        inst.press_mouse(position);
+    }
+
+    void release_mouse(Vector2 position) {
+        inst.release_mouse(position);
+    }
+
+    void move_mouse(Vector2 position) {
+        inst.move_mouse(position);
+    }
+
+    PackedByteArray render() {
+        if (!sk.surface || !sk.renderer || !exists(inst.artboard())) return PackedByteArray();
+        sk.surface->getCanvas()->resetMatrix();
+        sk.renderer->transform(inst.current_transform);
+        sk.clear();
+        inst.draw(sk.renderer.get());
+        return sk.bytes();
+    }
+
+    int width() const {
+        return props.width();
+    }
+
+    int height() const {
+        return props.height();
+    }
+
+    Ref<RiveFile> file() const {
+        return inst.file;
+    }
+
+    Ref<RiveArtboard> artboard() const {
+        return inst.artboard();
+    }
+
+    Ref<RiveScene> scene() const {
+        return inst.scene();
+    }
+
+    Ref<RiveAnimation> animation() const {
+        return inst.animation();
+    }
+};
+
+#endif
@@ -4,13 +4,46 @@
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/godot.hpp>
 
+#include "canvas_factory.h"
+#include "flipbook_cache.hpp"
+#include "rive_baker.h"
+#include "rive_debug.h"
+#include "rive_instance_pool.h"
+#include "rive_monitors.h"
+#include "rive_multi_instance_2d.h"
+#include "rive_profiler.h"
+#include "rive_profiler_overlay.h"
+#include "rive_sprite_3d.h"
+#include "rive_texture.h"
 #include "rive_viewer.hpp"
+#include "texture_atlas.hpp"
+#include "tiled_raster.hpp"
 #include "rive_viewer_2d.hpp"
 
 using namespace godot;
 
+static RiveInstancePool *instance_pool = nullptr;
+static RiveMonitors *monitors = nullptr;
+static RiveDebug *debug = nullptr;
+static Ref<RiveProfiler> profiler;
+
+static void add_project_setting(String name, Variant default_value, PropertyHint hint, String hint_string) {
+    auto settings = ProjectSettings::get_singleton();
+    if (!settings->has_setting(name)) settings->set_setting(name, default_value);
+    settings->set_initial_value(name, default_value);
+    Dictionary property;
+    property["name"] = name;
+    property["type"] = default_value.get_type();
+    property["hint"] = hint;
+    property["hint_string"] = hint_string;
+    settings->add_property_info(property);
+}
+
 void initialize_rive_module(ModuleInitializationLevel p_level) {
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
         return;
@@ -18,18 +51,57 @@ void initialize_rive_module(ModuleInitializationLevel p_level) {
 
     ClassDB::register_class<RiveViewer>();
     ClassDB::register_class<RiveViewer2D>();
+    ClassDB::register_class<RiveMultiInstance2D>();
     ClassDB::register_class<RiveFile>();
     ClassDB::register_class<RiveArtboard>();
     ClassDB::register_class<RiveScene>();
     ClassDB::register_class<RiveInput>();
     ClassDB::register_class<RiveListener>();
     ClassDB::register_class<RiveAnimation>();
+    ClassDB::register_class<RiveBaker>();
+    ClassDB::register_class<RiveInstancePool>();
+    ClassDB::register_class<RiveTexture>();
+    ClassDB::register_class<RiveSprite3D>();
+    ClassDB::register_class<RiveMonitors>();
+    ClassDB::register_class<RiveProfilerOverlay>();
+    ClassDB::register_class<RiveDebug>();
+    ClassDB::register_class<RiveProfiler>();
+
+    instance_pool = memnew(RiveInstancePool);
+    Engine::get_singleton()->register_singleton("RiveInstancePool", instance_pool);
+    monitors = memnew(RiveMonitors);
+    debug = memnew(RiveDebug);
+    Engine::get_singleton()->register_singleton("RiveDebug", debug);
+    profiler.instantiate();
+    EngineDebugger::get_singleton()->register_profiler("rive", profiler);
+
+    add_project_setting(
+        FLIPBOOK_BUDGET_SETTING, FLIPBOOK_DEFAULT_BUDGET_MB, PROPERTY_HINT_RANGE, "0,4096,1,suffix:MB"
+    );
+    add_project_setting(
+        TILED_RASTER_THRESHOLD_SETTING, TILED_RASTER_DEFAULT_THRESHOLD, PROPERTY_HINT_RANGE, "0,33554432,1,suffix:px"
+    );
 }
 
 void uninitialize_rive_module(ModuleInitializationLevel p_level) {
     if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
         return;
     }
+
+    Engine::get_singleton()->unregister_singleton("RiveInstancePool");
+    memdelete(instance_pool);
+    instance_pool = nullptr;
+    memdelete(monitors);
+    monitors = nullptr;
+    Engine::get_singleton()->unregister_singleton("RiveDebug");
+    memdelete(debug);
+    debug = nullptr;
+    EngineDebugger::get_singleton()->unregister_profiler("rive");
+    profiler.unref();
+    FlipbookCache::get_singleton().clear();
+    CanvasFactory::get_singleton().clear();
+    TextureAtlas::get_singleton().clear();
+    TiledRaster::get_singleton().stop();
 }
 
 extern "C" {
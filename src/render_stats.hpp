@@ -0,0 +1,124 @@
+#ifndef _RIVEEXTENSION_RENDER_STATS_HPP_
+#define _RIVEEXTENSION_RENDER_STATS_HPP_
+
+// stdlib
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/variant/builtin_types.hpp>
+
+using namespace godot;
+
+// Process frames kept for the rolling statistics (two seconds at 60 fps)
+static const int RENDER_STATS_WINDOW = 120;
+
+/**
+ * Rolling per-viewer cost over the last RENDER_STATS_WINDOW process frames. The viewer times its own work into
+ * sample() and closes it with end_frame(); a frame counts as skipped when nothing was rendered, e.g. because the
+ * viewer was paused, hidden or unchanged. Upload time includes reading the surface back.
+ */
+class RenderStats {
+   public:
+    struct Sample {
+        uint64_t advance_nsec = 0;
+        uint64_t raster_nsec = 0;
+        uint64_t upload_nsec = 0;
+        uint64_t bytes = 0;
+        bool rendered = false;
+    };
+
+   private:
+    std::vector<Sample> samples;
+    Sample current;
+    Sample last;
+    int next = 0;
+
+    static Dictionary summarize(std::vector<uint64_t> &nsec) {
+        Dictionary result;
+        double sum = 0;
+        for (uint64_t value : nsec) sum += value;
+        double p95 = 0;
+        if (!nsec.empty()) {
+            auto nth = nsec.begin() + (nsec.size() * 95) / 100;
+            if (nth == nsec.end()) nth--;
+            std::nth_element(nsec.begin(), nth, nsec.end());
+            p95 = *nth;
+        }
+        result["avg"] = nsec.empty() ? 0.0 : sum / nsec.size() / 1000000.0;
+        result["p95"] = p95 / 1000000.0;
+        return result;
+    }
+
+   public:
+    /* Sample of the frame in progress. */
+    Sample &sample() {
+        return current;
+    }
+
+    void end_frame(bool rendered) {
+        current.rendered = rendered;
+        if (samples.size() < RENDER_STATS_WINDOW) samples.push_back(current);
+        else samples[next] = current;
+        next = (next + 1) % RENDER_STATS_WINDOW;
+        last = current;
+        current = Sample();
+    }
+
+    /* The most recently closed sample. */
+    const Sample &get_last() const {
+        return last;
+    }
+
+    /* Average and 95th percentile times in milliseconds, over rendered frames only. */
+    Dictionary to_dictionary() const {
+        std::vector<uint64_t> advance, raster, upload;
+        uint64_t bytes = 0;
+        int rendered = 0;
+        for (auto &s : samples) {
+            if (!s.rendered) continue;
+            rendered++;
+            advance.push_back(s.advance_nsec);
+            raster.push_back(s.raster_nsec);
+            upload.push_back(s.upload_nsec);
+            bytes += s.bytes;
+        }
+        Dictionary advance_stats = summarize(advance);
+        Dictionary raster_stats = summarize(raster);
+        Dictionary upload_stats = summarize(upload);
+
+        Dictionary result;
+        result["advance_ms_avg"] = advance_stats["avg"];
+        result["advance_ms_p95"] = advance_stats["p95"];
+        result["raster_ms_avg"] = raster_stats["avg"];
+        result["raster_ms_p95"] = raster_stats["p95"];
+        result["upload_ms_avg"] = upload_stats["avg"];
+        result["upload_ms_p95"] = upload_stats["p95"];
+        result["frames_rendered"] = rendered;
+        result["frames_skipped"] = (int)samples.size() - rendered;
+        result["bytes_per_frame"] = rendered ? (int64_t)(bytes / rendered) : 0;
+        return result;
+    }
+
+    /* Average total cost of a rendered frame, in milliseconds. */
+    double get_cost_ms() const {
+        uint64_t nsec = 0;
+        int rendered = 0;
+        for (auto &s : samples) {
+            if (!s.rendered) continue;
+            rendered++;
+            nsec += s.advance_nsec + s.raster_nsec + s.upload_nsec;
+        }
+        return rendered ? nsec / 1000000.0 / rendered : 0.0;
+    }
+
+    void clear() {
+        samples.clear();
+        current = Sample();
+        last = Sample();
+        next = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,215 @@
+#include "rive_baker.h"
+
+// stdlib
+#include <cmath>
+#include <map>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+// extension
+#include "offscreen_instance.hpp"
+#include "rive_exceptions.hpp"
+#include "utils/memory.hpp"
+
+static const int BAKE_MAX_ATLAS_SIZE = 8192;
+
+struct BakedFrame {
+    PackedByteArray pixels;
+    Ref<Image> image;
+    Rect2i used;
+    Vector2i position;
+};
+
+static uint64_t hash_bytes(const PackedByteArray &bytes) {
+    // FNV-1a, only used to bucket candidates before an exact comparison
+    uint64_t hash = 14695981039346656037ULL;
+    const uint8_t *data = bytes.ptr();
+    for (int64_t i = 0; i < bytes.size(); i++) hash = (hash ^ data[i]) * 1099511628211ULL;
+    return hash;
+}
+
+static int next_power_of_two(int value) {
+    int result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+/* Shelf-packs the frames, tallest first. Returns the atlas size, or an empty size if they don't fit. */
+static Vector2i pack(std::vector<BakedFrame> &frames, int padding) {
+    std::vector<int> order(frames.size());
+    int64_t area = 0;
+    int widest = 1;
+    for (int i = 0; i < frames.size(); i++) {
+        order[i] = i;
+        area += (int64_t)(frames[i].used.size.x + padding) * (frames[i].used.size.y + padding);
+        widest = std::max(widest, frames[i].used.size.x + padding);
+    }
+    std::sort(order.begin(), order.end(), [&frames](int a, int b) {
+        return frames[a].used.size.y > frames[b].used.size.y;
+    });
+
+    int width = next_power_of_two(std::max(widest, (int)std::ceil(std::sqrt((double)area))));
+    while (width <= BAKE_MAX_ATLAS_SIZE) {
+        int x = 0, y = 0, shelf = 0;
+        for (int i : order) {
+            Vector2i frame_size = frames[i].used.size + Vector2i(padding, padding);
+            if (x + frame_size.x > width) {
+                x = 0;
+                y += shelf;
+                shelf = 0;
+            }
+            frames[i].position = Vector2i(x, y);
+            x += frame_size.x;
+            shelf = std::max(shelf, frame_size.y);
+        }
+        int height = y + shelf;
+        if (height <= BAKE_MAX_ATLAS_SIZE) return Vector2i(width, next_power_of_two(height));
+        width <<= 1;
+    }
+    return Vector2i();
+}
+
+static String write_sprite_frames(
+    String png_path,
+    String animation_name,
+    float fps,
+    bool loop,
+    const std::vector<BakedFrame> &frames,
+    const std::vector<int> &sequence,
+    Vector2i frame_size
+) {
+    PackedStringArray lines;
+    lines.append(
+        String("[gd_resource type=\"SpriteFrames\" load_steps={0} format=3]\n").format(Array::make((int)frames.size() + 2))
+    );
+    lines.append(String("[ext_resource type=\"Texture2D\" path=\"{0}\" id=\"1\"]\n").format(Array::make(png_path)));
+
+    for (int i = 0; i < frames.size(); i++) {
+        const BakedFrame &frame = frames[i];
+        Rect2 region = Rect2(frame.position, frame.used.size);
+        Rect2 margin = Rect2(frame.used.position, frame_size - frame.used.size);
+        lines.append(String("[sub_resource type=\"AtlasTexture\" id=\"AtlasTexture_{0}\"]").format(Array::make(i)));
+        lines.append("atlas = ExtResource(\"1\")");
+        lines.append("region = " + UtilityFunctions::var_to_str(region));
+        lines.append("margin = " + UtilityFunctions::var_to_str(margin));
+        lines.append("filter_clip = true\n");
+    }
+
+    // Consecutive duplicates collapse into a single longer frame
+    PackedStringArray entries;
+    for (int i = 0; i < sequence.size();) {
+        int run = 1;
+        while (i + run < sequence.size() && sequence[i + run] == sequence[i]) run++;
+        entries.append(
+            String("{\n\"duration\": {0},\n\"texture\": SubResource(\"AtlasTexture_{1}\")\n}")
+                .format(Array::make(String::num(run, 1), sequence[i]))
+        );
+        i += run;
+    }
+
+    lines.append("[resource]");
+    lines.append("animations = [{");
+    lines.append("\"frames\": [" + String(", ").join(entries) + "],");
+    lines.append(String("\"loop\": ") + (loop ? "true" : "false") + ",");
+    lines.append("\"name\": " + UtilityFunctions::var_to_str(StringName(animation_name)) + ",");
+    lines.append("\"speed\": " + String::num(fps, 3));
+    lines.append("}]");
+    return String("\n").join(lines) + "\n";
+}
+
+Error RiveBaker::bake(String output_path) {
+    frame_count = 0;
+    unique_frame_count = 0;
+    try {
+        if (output_path.is_empty()) throw RiveException("No output path provided.").from(this, "bake");
+
+        OffscreenInstance offscreen;
+        if (!offscreen.load(file_path, artboard, scene, scene == -1 ? animation : -1, size.x, size.y))
+            throw RiveException("Unable to instantiate <" + file_path + ">").from(this, "bake");
+
+        auto scene_ref = offscreen.scene();
+        auto anim = offscreen.animation();
+        float length = duration;
+        if (length <= 0 && exists(anim)) length = anim->get_duration();
+        if (length <= 0)
+            throw RiveException("Nothing to bake; set a duration when baking a state machine.").from(this, "bake");
+
+        std::vector<Dictionary> events;
+        for (int i = 0; i < timeline.size(); i++)
+            if (timeline[i].get_type() == Variant::DICTIONARY) events.push_back(timeline[i]);
+        std::stable_sort(events.begin(), events.end(), [](const Dictionary &a, const Dictionary &b) {
+            return (float)a.get("time", 0) < (float)b.get("time", 0);
+        });
+
+        frame_count = std::max((int)std::round(length * fps), 1);
+        std::vector<BakedFrame> frames;
+        std::vector<int> sequence;
+        std::multimap<uint64_t, int> seen;
+        int next_event = 0;
+
+        for (int i = 0; i < frame_count; i++) {
+            float time = i / fps;
+            while (next_event < events.size() && (float)events[next_event].get("time", 0) <= time) {
+                const Dictionary &event = events[next_event++];
+                if (!exists(scene_ref)) continue;
+                Ref<RiveInput> input = scene_ref->find_input(event.get("input", ""));
+                if (exists(input)) input->set_value(event.get("value", nullptr));
+            }
+
+            offscreen.advance(i == 0 ? 0 : 1.0f / fps);
+            PackedByteArray pixels = offscreen.render();
+            if (pixels.is_empty()) throw RiveException("Failed to rasterize frame.").from(this, "bake");
+
+            uint64_t hash = hash_bytes(pixels);
+            int match = -1;
+            if (deduplicate) {
+                auto range = seen.equal_range(hash);
+                for (auto it = range.first; it != range.second && match == -1; it++)
+                    if (frames[it->second].pixels == pixels) match = it->second;
+            }
+            if (match != -1) {
+                sequence.push_back(match);
+                continue;
+            }
+
+            BakedFrame frame;
+            Ref<Image> image = Image::create_from_data(size.x, size.y, false, Image::FORMAT_RGBA8, pixels);
+            frame.used = trim ? image->get_used_rect() : Rect2i(Vector2i(), size);
+            if (frame.used.size.x < 1 || frame.used.size.y < 1) frame.used = Rect2i(0, 0, 1, 1);
+            frame.image = image->get_region(frame.used);
+            if (deduplicate) frame.pixels = pixels;
+            seen.insert({ hash, (int)frames.size() });
+            sequence.push_back(frames.size());
+            frames.push_back(frame);
+        }
+        unique_frame_count = frames.size();
+
+        Vector2i atlas_size = pack(frames, padding);
+        if (atlas_size == Vector2i())
+            throw RiveException("Frames don't fit in a single atlas; lower the size or fps.").from(this, "bake");
+
+        Ref<Image> atlas = Image::create(atlas_size.x, atlas_size.y, false, Image::FORMAT_RGBA8);
+        for (const BakedFrame &frame : frames)
+            atlas->blit_rect(frame.image, Rect2i(Vector2i(), frame.used.size), frame.position);
+
+        String png_path = output_path + ".png";
+        Error err = atlas->save_png(png_path);
+        if (err != OK) throw RiveException("Unable to write <" + png_path + ">").from(this, "bake");
+
+        String name = exists(scene_ref) ? scene_ref->get_name() : exists(anim) ? anim->get_name() : "default";
+        bool loop = exists(scene_ref) || (exists(anim) && anim->get_loop_mode() != (int)rive::Loop::oneShot);
+        String tres_path = output_path + ".tres";
+        Ref<FileAccess> out = FileAccess::open(tres_path, FileAccess::WRITE);
+        if (is_null(out)) throw RiveException("Unable to write <" + tres_path + ">").from(this, "bake");
+        out->store_string(write_sprite_frames(png_path, name, fps, loop, frames, sequence, size));
+        out->close();
+    } catch (RiveException error) {
+        error.report();
+        return ERR_CANT_CREATE;
+    }
+    return OK;
+}
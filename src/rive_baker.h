@@ -0,0 +1,166 @@
+#ifndef RIVEEXTENSION_BAKER_H
+#define RIVEEXTENSION_BAKER_H
+
+// stdlib
+#include <algorithm>
+
+// godot-cpp
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "utils/godot_macros.hpp"
+
+using namespace godot;
+
+/**
+ * Renders a linear animation (or a state machine driven by an input timeline) through the Skia raster path faster
+ * than real time, then writes a packed atlas PNG and a SpriteFrames resource that plays it back without Rive.
+ *
+ * Timeline entries are dictionaries of the form { "time": float, "input": String, "value": bool|float }.
+ */
+class RiveBaker : public RefCounted {
+    GDCLASS(RiveBaker, RefCounted);
+
+   private:
+    String file_path;
+    int artboard = 0;
+    int scene = -1;
+    int animation = 0;
+    Vector2i size = Vector2i(256, 256);
+    float fps = 30;
+    float duration = 0;
+    Array timeline;
+    bool trim = true;
+    bool deduplicate = true;
+    int padding = 1;
+
+    int frame_count = 0;
+    int unique_frame_count = 0;
+
+   protected:
+    static void _bind_methods() {
+        ADD_PROP_WITH_HINT(RiveBaker, Variant::STRING, file_path, PROPERTY_HINT_FILE, "*.riv");
+        ADD_PROP(RiveBaker, Variant::INT, artboard);
+        ADD_PROP(RiveBaker, Variant::INT, scene);
+        ADD_PROP(RiveBaker, Variant::INT, animation);
+        ADD_PROP(RiveBaker, Variant::VECTOR2I, size);
+        ADD_PROP(RiveBaker, Variant::FLOAT, fps);
+        ADD_PROP(RiveBaker, Variant::FLOAT, duration);
+        ADD_PROP(RiveBaker, Variant::ARRAY, timeline);
+        ADD_PROP(RiveBaker, Variant::BOOL, trim);
+        ADD_PROP(RiveBaker, Variant::BOOL, deduplicate);
+        ADD_PROP(RiveBaker, Variant::INT, padding);
+        BIND_GET(RiveBaker, frame_count);
+        BIND_GET(RiveBaker, unique_frame_count);
+        ClassDB::bind_method(D_METHOD("bake", "output_path"), &RiveBaker::bake);
+    }
+
+   public:
+    /* Writes <output_path>.png and <output_path>.tres. */
+    Error bake(String output_path);
+
+    /* Setters */
+
+    void set_file_path(String value) {
+        file_path = value;
+    }
+
+    void set_artboard(int value) {
+        artboard = value;
+    }
+
+    void set_scene(int value) {
+        scene = value;
+    }
+
+    void set_animation(int value) {
+        animation = value;
+    }
+
+    void set_size(Vector2i value) {
+        size = Vector2i(std::max(value.x, 1), std::max(value.y, 1));
+    }
+
+    void set_fps(float value) {
+        fps = std::max(value, 1.0f);
+    }
+
+    void set_duration(float value) {
+        duration = std::max(value, 0.0f);
+    }
+
+    void set_timeline(Array value) {
+        timeline = value;
+    }
+
+    void set_trim(bool value) {
+        trim = value;
+    }
+
+    void set_deduplicate(bool value) {
+        deduplicate = value;
+    }
+
+    void set_padding(int value) {
+        padding = std::max(value, 0);
+    }
+
+    /* Getters */
+
+    String get_file_path() const {
+        return file_path;
+    }
+
+    int get_artboard() const {
+        return artboard;
+    }
+
+    int get_scene() const {
+        return scene;
+    }
+
+    int get_animation() const {
+        return animation;
+    }
+
+    Vector2i get_size() const {
+        return size;
+    }
+
+    float get_fps() const {
+        return fps;
+    }
+
+    float get_duration() const {
+        return duration;
+    }
+
+    Array get_timeline() const {
+        return timeline;
+    }
+
+    bool get_trim() const {
+        return trim;
+    }
+
+    bool get_deduplicate() const {
+        return deduplicate;
+    }
+
+    int get_padding() const {
+        return padding;
+    }
+
+    int get_frame_count() const {
+        return frame_count;
+    }
+
+    int get_unique_frame_count() const {
+        return unique_frame_count;
+    }
+};
+
+#endif
@@ -0,0 +1,88 @@
+#include "rive_debug.h"
+
+// extension
+#include "rive_exceptions.hpp"
+
+RiveDebug *RiveDebug::singleton = nullptr;
+
+void RiveDebug::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("is_trace_available"), &RiveDebug::is_trace_available);
+    ClassDB::bind_method(D_METHOD("start_trace", "capacity"), &RiveDebug::start_trace, DEFVAL(TRACE_DEFAULT_CAPACITY));
+    ClassDB::bind_method(D_METHOD("stop_trace"), &RiveDebug::stop_trace);
+    ClassDB::bind_method(D_METHOD("clear_trace"), &RiveDebug::clear_trace);
+    ClassDB::bind_method(D_METHOD("is_tracing"), &RiveDebug::is_tracing);
+    ClassDB::bind_method(D_METHOD("get_trace_event_count"), &RiveDebug::get_trace_event_count);
+    ClassDB::bind_method(D_METHOD("dump_trace", "path"), &RiveDebug::dump_trace);
+}
+
+RiveDebug *RiveDebug::get_singleton() {
+    return singleton;
+}
+
+RiveDebug::RiveDebug() {
+    singleton = this;
+}
+
+RiveDebug::~RiveDebug() {
+    if (singleton == this) singleton = nullptr;
+}
+
+bool RiveDebug::is_trace_available() const {
+#ifdef RIVE_TRACE_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
+void RiveDebug::start_trace(int capacity) {
+#ifdef RIVE_TRACE_ENABLED
+    if (capacity < 1) {
+        RiveException("Trace capacity must be at least 1.").from(this, "start_trace").warning().report();
+        return;
+    }
+    Tracer::get_singleton().start(capacity);
+#else
+    RiveException("Tracing is not available in release builds.").from(this, "start_trace").warning().report();
+#endif
+}
+
+void RiveDebug::stop_trace() {
+#ifdef RIVE_TRACE_ENABLED
+    Tracer::get_singleton().stop();
+#endif
+}
+
+void RiveDebug::clear_trace() {
+#ifdef RIVE_TRACE_ENABLED
+    Tracer::get_singleton().clear();
+#endif
+}
+
+bool RiveDebug::is_tracing() const {
+#ifdef RIVE_TRACE_ENABLED
+    return Tracer::get_singleton().is_enabled();
+#else
+    return false;
+#endif
+}
+
+int RiveDebug::get_trace_event_count() const {
+#ifdef RIVE_TRACE_ENABLED
+    return Tracer::get_singleton().get_count();
+#else
+    return 0;
+#endif
+}
+
+Error RiveDebug::dump_trace(String path) {
+#ifdef RIVE_TRACE_ENABLED
+    Error error = Tracer::get_singleton().dump(path);
+    if (error != OK)
+        RiveException("Unable to write trace to <" + path + ">.").from(this, "dump_trace").warning().report();
+    return error;
+#else
+    RiveException("Tracing is not available in release builds.").from(this, "dump_trace").warning().report();
+    return ERR_UNAVAILABLE;
+#endif
+}
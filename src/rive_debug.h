@@ -0,0 +1,45 @@
+#ifndef RIVEEXTENSION_DEBUG_H
+#define RIVEEXTENSION_DEBUG_H
+
+// godot-cpp
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "utils/trace.hpp"
+
+using namespace godot;
+
+/**
+ * Debugging entry points, registered as the RiveDebug engine singleton. Tracing records property flush, load, import,
+ * instantiate, pointer, advance, raster, copy and upload events into a ring buffer; dump_trace() writes them as
+ * Chrome trace JSON for chrome://tracing or ui.perfetto.dev. Tracing is compiled out of release builds, where
+ * start_trace() warns and dump_trace() returns ERR_UNAVAILABLE.
+ */
+class RiveDebug : public Object {
+    GDCLASS(RiveDebug, Object);
+
+   private:
+    static RiveDebug *singleton;
+
+   protected:
+    static void _bind_methods();
+
+   public:
+    static RiveDebug *get_singleton();
+
+    RiveDebug();
+    ~RiveDebug();
+
+    bool is_trace_available() const;
+    void start_trace(int capacity = TRACE_DEFAULT_CAPACITY);
+    void stop_trace();
+    void clear_trace();
+    bool is_tracing() const;
+    int get_trace_event_count() const;
+    Error dump_trace(String path);
+};
+
+#endif
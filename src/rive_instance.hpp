@@ -25,16 +25,24 @@
 #include <skia/renderer/include/skia_renderer.hpp>
 
 // Extension
+#include "animation_mixer.hpp"
 #include "api/rive_file.hpp"
+#include "artboard_composer.hpp"
 #include "utils/memory.hpp"
+#include "utils/trace.hpp"
 #include "viewer_props.hpp"
 
 struct RiveInstance {
     friend class RiveViewerBase;
+    friend class OffscreenInstance;
 
     ViewerProps *props;
     Ref<RiveFile> file;
     rive::Mat2D current_transform;
+    AnimationMixer mixer;
+    ArtboardComposer composer;
+    // Viewer, file and artboard attached to trace events
+    TraceContext trace_context;
 
     void set_props(ViewerProps *props_value) {
         props = props_value;
@@ -50,13 +58,17 @@ struct RiveInstance {
 
     rive::Mat2D get_transform() const {
         auto ab = artboard();
-        if (props && exists(ab))
+        if (props && exists(ab)) {
+            // A view rect acts as a camera: it is fitted into the viewer in place of the artboard's bounds
+            Rect2 view = props->view_rect();
             return rive::computeAlignment(
                 props->rive_fit(),
                 props->rive_alignment(),
                 rive::AABB(0, 0, props->width(), props->height()),
-                ab->artboard->bounds()
+                props->has_view_rect() ? rive::AABB(view.position.x, view.position.y, view.get_end().x, view.get_end().y)
+                                       : ab->artboard->bounds()
             );
+        }
         return rive::Mat2D();
     }
 
@@ -66,17 +78,36 @@ struct RiveInstance {
 
     void reset() {
         auto ab = artboard();
+        mixer.unbind();
         if (exists(file) && props->artboard() != -1) file->reset_artboard(props->artboard());
         if (exists(ab) && props->scene() != -1) ab->reset_scene(props->scene());
         if (exists(ab) && props->animation() != -1) ab->reset_animation(props->animation());
     }
 
     bool advance(float delta) {
+        if (!exists(artboard()) && composer.empty()) return false;
+        RIVE_TRACE(TRACE_ADVANCE, trace_context);
+        bool composed = composer.advance(delta);
+        return advance_artboard(delta) || composed;
+    }
+
+    bool advance_artboard(float delta) {
         auto sm = scene();
         auto anim = animation();
         auto ab = artboard();
-        
-        if (exists(sm)) {
+
+        if (!mixer.empty() && exists(ab)) {
+            // Apply the base and every layer first, so the artboard is advanced once for all of them
+            bool playing = false;
+            if (exists(sm)) playing = sm->scene->advance(delta);
+            else if (exists(anim)) {
+                playing = anim->animation->advance(delta);
+                anim->animation->apply();
+            }
+            playing |= mixer.apply(ab->artboard.get(), ab->get_instance_id(), delta);
+            return ab->artboard->advance(delta) || playing;
+        }
+        else if (exists(sm)) {
             return sm->scene->advanceAndApply(delta);
         }
         else if (exists(anim)) {
@@ -91,16 +122,19 @@ struct RiveInstance {
     }
 
     void press_mouse(godot::Vector2 position) {
+        RIVE_TRACE(TRACE_POINTER, trace_context);
         auto sm = scene();
         if (exists(sm)) sm->press_mouse(current_transform.invertOrIdentity(), position);
     }
 
     void release_mouse(godot::Vector2 position) {
+        RIVE_TRACE(TRACE_POINTER, trace_context);
         auto sm = scene();
         if (exists(sm)) sm->release_mouse(current_transform.invertOrIdentity(), position);
     }
 
     void move_mouse(godot::Vector2 position) {
+        RIVE_TRACE(TRACE_POINTER, trace_context);
         auto sm = scene();
         if (exists(sm)) sm->move_mouse(current_transform.invertOrIdentity(), position);
     }
@@ -112,6 +146,7 @@ struct RiveInstance {
 
    protected:
     void instantiate() const {
+        RIVE_TRACE(TRACE_INSTANTIATE, trace_context);
         try {
             if (exists(file)) file->_instantiate_artboards();
             auto ab = artboard();
@@ -143,6 +178,8 @@ struct RiveInstance {
 
    private:
     void on_path_changed(godot::String path) {
+        mixer.clear();
+        composer.clear();
         if (exists(file)) unref(file);
         on_artboard_changed(-1);
         on_animation_changed(-1);
@@ -150,6 +187,8 @@ struct RiveInstance {
     }
 
     void on_artboard_changed(int index) {
+        // Layer indices belong to the previous artboard
+        mixer.clear();
         if (exists(file)) file->get_artboard(index);
     }
 
@@ -162,6 +201,7 @@ struct RiveInstance {
     }
 
     void on_scene_properties_changed() {
+        RIVE_TRACE(TRACE_PROPERTY_FLUSH, trace_context);
         auto sm = scene();
         if (exists(sm)) {
             auto scene_props = props->scene_properties();
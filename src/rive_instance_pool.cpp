@@ -0,0 +1,95 @@
+#include "rive_instance_pool.h"
+
+// extension
+#include "rive_exceptions.hpp"
+#include "utils/memory.hpp"
+#include "utils/read_rive_file.hpp"
+
+RiveInstancePool *RiveInstancePool::singleton = nullptr;
+
+void RiveInstancePool::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("warm", "path", "count"), &RiveInstancePool::warm);
+    ClassDB::bind_method(D_METHOD("get_available", "path"), &RiveInstancePool::get_available);
+    ClassDB::bind_method(D_METHOD("clear", "path"), &RiveInstancePool::clear, DEFVAL(""));
+}
+
+RiveInstancePool *RiveInstancePool::get_singleton() {
+    return singleton;
+}
+
+RiveInstancePool::RiveInstancePool() {
+    singleton = this;
+}
+
+RiveInstancePool::~RiveInstancePool() {
+    pools.clear();
+    if (singleton == this) singleton = nullptr;
+}
+
+RiveInstancePool::Pool *RiveInstancePool::get_pool(String path) {
+    auto found = pools.find(path);
+    if (found != pools.end()) return &found->second;
+
+    std::shared_ptr<rive::File> file = read_rive_file(path, factory.get());
+    if (!file) return nullptr;
+    Pool &pool = pools[path];
+    pool.file = std::move(file);
+    return &pool;
+}
+
+void RiveInstancePool::warm_artboard(Ref<RiveArtboard> artboard) {
+    if (!exists(artboard)) return;
+    for (int i = 0; i < artboard->get_scene_count(); i++) {
+        auto scene = artboard->get_scene(i);
+        if (exists(scene))
+            for (int j = 0; j < scene->get_input_count(); j++) scene->get_input(j);
+    }
+    for (int i = 0; i < artboard->get_animation_count(); i++) artboard->get_animation(i);
+}
+
+Ref<RiveFile> RiveInstancePool::create(Pool &pool, String path) {
+    Ref<RiveFile> file = RiveFile::MakeRef(pool.file, path);
+    if (is_null(file)) return nullptr;
+    for (int i = 0; i < file->get_artboard_count(); i++) warm_artboard(file->get_artboard(i));
+    return file;
+}
+
+Ref<RiveFile> RiveInstancePool::acquire(String path) {
+    Pool *pool = get_pool(path);
+    if (!pool) return nullptr;
+    if (pool->available.empty()) return create(*pool, path);
+    Ref<RiveFile> file = pool->available.back();
+    pool->available.pop_back();
+    return file;
+}
+
+void RiveInstancePool::release(Ref<RiveFile> file, int artboard) {
+    if (!exists(file)) return;
+    auto found = pools.find(file->get_path());
+    if (found == pools.end() || found->second.file != file->file) return;
+
+    // Resetting here keeps acquire() allocation free
+    if (artboard >= 0 && artboard < file->get_artboard_count()) warm_artboard(file->reset_artboard(artboard));
+    found->second.available.push_back(file);
+}
+
+int RiveInstancePool::warm(String path, int count) {
+    Pool *pool = get_pool(path);
+    if (!pool) return 0;
+    while ((int)pool->available.size() < count) {
+        Ref<RiveFile> file = create(*pool, path);
+        if (is_null(file)) break;
+        pool->available.push_back(file);
+    }
+    return pool->available.size();
+}
+
+int RiveInstancePool::get_available(String path) const {
+    auto found = pools.find(path);
+    return found != pools.end() ? found->second.available.size() : 0;
+}
+
+void RiveInstancePool::clear(String path) {
+    if (path.is_empty()) pools.clear();
+    else pools.erase(path);
+}
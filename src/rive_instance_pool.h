@@ -0,0 +1,64 @@
+#ifndef RIVEEXTENSION_INSTANCE_POOL_H
+#define RIVEEXTENSION_INSTANCE_POOL_H
+
+// stdlib
+#include <map>
+#include <memory>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// skia
+#include <skia/renderer/include/skia_factory.hpp>
+
+// extension
+#include "api/rive_file.hpp"
+#include "utils/types.hpp"
+
+using namespace godot;
+
+/**
+ * Per-file pools of fully instantiated RiveFile wrappers (artboards, state machines, animations and inputs). Every
+ * wrapper of a path shares one import. Viewers with use_pool acquire a ready wrapper instead of importing and
+ * instantiating on spawn; the artboard they used is reset when they release it.
+ *
+ * Registered as the RiveInstancePool engine singleton so pools can be warmed while loading.
+ */
+class RiveInstancePool : public Object {
+    GDCLASS(RiveInstancePool, Object);
+
+   private:
+    struct Pool {
+        std::shared_ptr<rive::File> file;
+        std::vector<Ref<RiveFile>> available;
+    };
+
+    static RiveInstancePool *singleton;
+    std::map<String, Pool> pools;
+    Ptr<rive::SkiaFactory> factory = rivestd::make_unique<rive::SkiaFactory>();
+
+    Pool *get_pool(String path);
+    Ref<RiveFile> create(Pool &pool, String path);
+    static void warm_artboard(Ref<RiveArtboard> artboard);
+
+   protected:
+    static void _bind_methods();
+
+   public:
+    static RiveInstancePool *get_singleton();
+
+    RiveInstancePool();
+    ~RiveInstancePool();
+
+    Ref<RiveFile> acquire(String path);
+    void release(Ref<RiveFile> file, int artboard);
+    int warm(String path, int count);
+    int get_available(String path) const;
+    void clear(String path = "");
+};
+
+#endif
@@ -0,0 +1,144 @@
+#include "rive_monitors.h"
+
+// godot-cpp
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+
+// extension
+#include "rive_profiler.h"
+#include "rive_stats.hpp"
+
+static const char *MONITORS[][2] = {
+    { "Rive/Active Viewers", "get_active_viewers" },
+    { "Rive/Sleeping Viewers", "get_sleeping_viewers" },
+    { "Rive/Culled Viewers", "get_culled_viewers" },
+    { "Rive/Load (ms)", "get_load_time" },
+    { "Rive/Advance (ms)", "get_advance_time" },
+    { "Rive/Raster (ms)", "get_raster_time" },
+    { "Rive/Copy (ms)", "get_copy_time" },
+    { "Rive/Upload (ms)", "get_upload_time" },
+    { "Rive/Uploaded Bytes", "get_uploaded_bytes" },
+    { "Rive/Reinstantiations", "get_reinstantiations" },
+    { "Rive/Imported Files", "get_file_count" },
+    { "Rive/Imported File Memory", "get_file_memory" },
+};
+
+static double nsec_to_ms(uint64_t nsec) {
+    return nsec / 1000000.0;
+}
+
+void RiveMonitors::_bind_methods() {
+    ClassDB::bind_method(D_METHOD("_frame"), &RiveMonitors::_frame);
+    ClassDB::bind_method(D_METHOD("_process_frame"), &RiveMonitors::_process_frame);
+    ClassDB::bind_method(D_METHOD("_connect_tree"), &RiveMonitors::_connect_tree);
+    ClassDB::bind_method(D_METHOD("get_active_viewers"), &RiveMonitors::get_active_viewers);
+    ClassDB::bind_method(D_METHOD("get_sleeping_viewers"), &RiveMonitors::get_sleeping_viewers);
+    ClassDB::bind_method(D_METHOD("get_culled_viewers"), &RiveMonitors::get_culled_viewers);
+    ClassDB::bind_method(D_METHOD("get_load_time"), &RiveMonitors::get_load_time);
+    ClassDB::bind_method(D_METHOD("get_advance_time"), &RiveMonitors::get_advance_time);
+    ClassDB::bind_method(D_METHOD("get_raster_time"), &RiveMonitors::get_raster_time);
+    ClassDB::bind_method(D_METHOD("get_copy_time"), &RiveMonitors::get_copy_time);
+    ClassDB::bind_method(D_METHOD("get_upload_time"), &RiveMonitors::get_upload_time);
+    ClassDB::bind_method(D_METHOD("get_uploaded_bytes"), &RiveMonitors::get_uploaded_bytes);
+    ClassDB::bind_method(D_METHOD("get_reinstantiations"), &RiveMonitors::get_reinstantiations);
+    ClassDB::bind_method(D_METHOD("get_file_count"), &RiveMonitors::get_file_count);
+    ClassDB::bind_method(D_METHOD("get_file_memory"), &RiveMonitors::get_file_memory);
+}
+
+RiveMonitors::RiveMonitors() {
+    // Frame counters roll over once everything, including on_draw uploads, has been drawn
+    RenderingServer::get_singleton()->connect("frame_post_draw", Callable(this, "_frame"));
+    // The scene tree doesn't exist yet while extensions initialize
+    call_deferred("_connect_tree");
+    auto performance = Performance::get_singleton();
+    for (auto &monitor : MONITORS) {
+        if (!performance->has_custom_monitor(monitor[0]))
+            performance->add_custom_monitor(monitor[0], Callable(this, monitor[1]));
+    }
+}
+
+RiveMonitors::~RiveMonitors() {
+    auto performance = Performance::get_singleton();
+    for (auto &monitor : MONITORS) {
+        if (performance->has_custom_monitor(monitor[0])) performance->remove_custom_monitor(monitor[0]);
+    }
+    auto rendering_server = RenderingServer::get_singleton();
+    if (rendering_server->is_connected("frame_post_draw", Callable(this, "_frame")))
+        rendering_server->disconnect("frame_post_draw", Callable(this, "_frame"));
+    auto tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+    if (tree && tree->is_connected("process_frame", Callable(this, "_process_frame")))
+        tree->disconnect("process_frame", Callable(this, "_process_frame"));
+}
+
+void RiveMonitors::_connect_tree() {
+    auto tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+    if (tree && !tree->is_connected("process_frame", Callable(this, "_process_frame")))
+        tree->connect("process_frame", Callable(this, "_process_frame"));
+}
+
+void RiveMonitors::_frame() {
+    drawn = true;
+    end_frame();
+}
+
+void RiveMonitors::_process_frame() {
+    // Headless runs never draw (and the renderer skips unchanged frames), so frame_post_draw doesn't fire. Roll over
+    // at the start of the next process step instead, unless a draw already did.
+    if (!drawn) end_frame();
+    drawn = false;
+}
+
+void RiveMonitors::end_frame() {
+    RiveProfiler::add_frame_data();
+    RiveStats::get_singleton().end_frame();
+}
+
+int RiveMonitors::get_active_viewers() const {
+    return RiveStats::get_singleton().count_viewers(VIEWER_ACTIVE);
+}
+
+int RiveMonitors::get_sleeping_viewers() const {
+    return RiveStats::get_singleton().count_viewers(VIEWER_SLEEPING);
+}
+
+int RiveMonitors::get_culled_viewers() const {
+    return RiveStats::get_singleton().count_viewers(VIEWER_CULLED);
+}
+
+double RiveMonitors::get_load_time() const {
+    return nsec_to_ms(RiveStats::get_singleton().last_frame().load_nsec);
+}
+
+double RiveMonitors::get_advance_time() const {
+    return nsec_to_ms(RiveStats::get_singleton().last_frame().advance_nsec);
+}
+
+double RiveMonitors::get_raster_time() const {
+    return nsec_to_ms(RiveStats::get_singleton().last_frame().raster_nsec);
+}
+
+double RiveMonitors::get_copy_time() const {
+    return nsec_to_ms(RiveStats::get_singleton().last_frame().copy_nsec);
+}
+
+double RiveMonitors::get_upload_time() const {
+    return nsec_to_ms(RiveStats::get_singleton().last_frame().upload_nsec);
+}
+
+int64_t RiveMonitors::get_uploaded_bytes() const {
+    return RiveStats::get_singleton().last_frame().uploaded_bytes;
+}
+
+int RiveMonitors::get_reinstantiations() const {
+    return RiveStats::get_singleton().last_frame().reinstantiations;
+}
+
+int RiveMonitors::get_file_count() const {
+    return RiveStats::get_singleton().get_file_count();
+}
+
+int64_t RiveMonitors::get_file_memory() const {
+    return RiveStats::get_singleton().get_file_bytes();
+}
@@ -0,0 +1,50 @@
+#ifndef RIVEEXTENSION_MONITORS_H
+#define RIVEEXTENSION_MONITORS_H
+
+// godot-cpp
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+using namespace godot;
+
+/**
+ * Publishes RiveStats as custom monitors, so Rive's cost shows up in the debugger's Monitors tab and can be read from
+ * scripts with Performance.get_custom_monitor("Rive/..."). Times are per frame, in milliseconds.
+ */
+class RiveMonitors : public Object {
+    GDCLASS(RiveMonitors, Object);
+
+   private:
+    // Whether frame_post_draw rolled the counters over since the last process_frame
+    bool drawn = false;
+
+    void end_frame();
+
+   protected:
+    static void _bind_methods();
+
+   public:
+    RiveMonitors();
+    ~RiveMonitors();
+
+    void _connect_tree();
+    void _frame();
+    void _process_frame();
+
+    int get_active_viewers() const;
+    int get_sleeping_viewers() const;
+    int get_culled_viewers() const;
+    double get_load_time() const;
+    double get_advance_time() const;
+    double get_raster_time() const;
+    double get_copy_time() const;
+    double get_upload_time() const;
+    int64_t get_uploaded_bytes() const;
+    int get_reinstantiations() const;
+    int get_file_count() const;
+    int64_t get_file_memory() const;
+};
+
+#endif
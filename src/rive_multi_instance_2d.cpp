@@ -0,0 +1,338 @@
+#include "rive_multi_instance_2d.h"
+
+// stdlib
+#include <algorithm>
+
+// rive-cpp
+#include <rive/animation/state_machine_input_instance.hpp>
+#include <rive/layout.hpp>
+
+// extension
+#include "rive_exceptions.hpp"
+#include "utils/memory.hpp"
+
+static rive::Mat2D to_mat2d(Transform2D transform) {
+    return rive::Mat2D(
+        transform.columns[0].x,
+        transform.columns[0].y,
+        transform.columns[1].x,
+        transform.columns[1].y,
+        transform.columns[2].x,
+        transform.columns[2].y
+    );
+}
+
+void RiveMultiInstance2D::_bind_methods() {
+    ADD_PROP_WITH_HINT(RiveMultiInstance2D, Variant::STRING, file_path, PROPERTY_HINT_FILE, "*.riv");
+    ADD_PROP(RiveMultiInstance2D, Variant::INT, artboard);
+    ADD_PROP(RiveMultiInstance2D, Variant::INT, scene);
+    ADD_PROP(RiveMultiInstance2D, Variant::INT, animation);
+    ADD_PROP_WITH_HINT(RiveMultiInstance2D, Variant::INT, fit, PROPERTY_HINT_ENUM, FitEnumPropertyHint);
+    ADD_PROP_WITH_HINT(RiveMultiInstance2D, Variant::INT, alignment, PROPERTY_HINT_ENUM, AlignEnumPropertyHint);
+    ADD_PROP(RiveMultiInstance2D, Variant::VECTOR2, size);
+    ADD_PROP(RiveMultiInstance2D, Variant::VECTOR2, instance_size);
+    ADD_PROP(RiveMultiInstance2D, Variant::BOOL, paused);
+    ClassDB::bind_method(D_METHOD("add_instance", "transform"), &RiveMultiInstance2D::add_instance);
+    ClassDB::bind_method(D_METHOD("remove_instance", "id"), &RiveMultiInstance2D::remove_instance);
+    ClassDB::bind_method(D_METHOD("clear_instances"), &RiveMultiInstance2D::clear_instances);
+    ClassDB::bind_method(D_METHOD("get_instance_count"), &RiveMultiInstance2D::get_instance_count);
+    ClassDB::bind_method(D_METHOD("has_instance", "id"), &RiveMultiInstance2D::has_instance);
+    ClassDB::bind_method(
+        D_METHOD("set_instance_transform", "id", "transform"), &RiveMultiInstance2D::set_instance_transform
+    );
+    ClassDB::bind_method(D_METHOD("get_instance_transform", "id"), &RiveMultiInstance2D::get_instance_transform);
+    ClassDB::bind_method(D_METHOD("set_instance_speed", "id", "speed"), &RiveMultiInstance2D::set_instance_speed);
+    ClassDB::bind_method(D_METHOD("get_instance_speed", "id"), &RiveMultiInstance2D::get_instance_speed);
+    ClassDB::bind_method(D_METHOD("get_instance_time", "id"), &RiveMultiInstance2D::get_instance_time);
+    ClassDB::bind_method(
+        D_METHOD("set_instance_input", "id", "name", "value"), &RiveMultiInstance2D::set_instance_input
+    );
+    ClassDB::bind_method(
+        D_METHOD("fire_instance_trigger", "id", "name"), &RiveMultiInstance2D::fire_instance_trigger
+    );
+}
+
+RiveMultiInstance2D::RiveMultiInstance2D() {
+    sk.set_props(&props);
+    props.size(512, 512);
+}
+
+void RiveMultiInstance2D::_ready() {
+    set_process(true);
+    load_file();
+}
+
+void RiveMultiInstance2D::_process(double delta) {
+    if (props.paused() || artboards.empty() || !is_visible_in_tree()) return;
+
+    const size_t count = artboards.size();
+    for (size_t i = 0; i < count; i++) {
+        if (!artboards[i]) continue;
+        float step = (float)delta * speeds[i];
+        times[i] += step;
+        if (machines[i]) machines[i]->advanceAndApply(step);
+        else if (animations[i]) animations[i]->advanceAndApply(step);
+        else artboards[i]->advance(step);
+    }
+    render();
+}
+
+void RiveMultiInstance2D::_draw() {
+    if (!is_null(texture)) draw_texture_rect(texture, Rect2(Vector2(), get_size()), false);
+}
+
+void RiveMultiInstance2D::render() {
+    if (!sk.surface || !sk.renderer) return;
+    SkCanvas *canvas = sk.surface->getCanvas();
+    canvas->resetMatrix();
+    sk.clear();
+
+    const rive::AABB viewport(0, 0, props.width(), props.height());
+    for (size_t i = 0; i < artboards.size(); i++) {
+        // Instances wait without drawing until the file and artboard resolve
+        if (!artboards[i]) continue;
+        // Skip instances that land entirely outside the surface
+        rive::AABB bounds = transforms[i].mapBoundingBox(artboards[i]->bounds());
+        if (bounds.right() < viewport.left() || bounds.left() > viewport.right() || bounds.bottom() < viewport.top()
+            || bounds.top() > viewport.bottom())
+            continue;
+        sk.renderer->save();
+        sk.renderer->transform(transforms[i]);
+        artboards[i]->draw(sk.renderer.get());
+        sk.renderer->restore();
+    }
+
+    PackedByteArray bytes = sk.bytes();
+    const int w = props.width(), h = props.height();
+    if (bytes.size() != w * h * 4) return;
+    if (is_null(image) || image->get_width() != w || image->get_height() != h) {
+        image = Image::create_from_data(w, h, false, Image::FORMAT_RGBA8, bytes);
+        texture = ImageTexture::create_from_image(image);
+    } else {
+        image->set_data(w, h, false, Image::FORMAT_RGBA8, bytes);
+        texture->update(image);
+    }
+    queue_redraw();
+}
+
+void RiveMultiInstance2D::load_file() {
+    if (!is_inside_tree()) return;
+
+    // Instances reference definitions owned by the file, so they have to go first
+    for (size_t i = 0; i < artboards.size(); i++) {
+        machines[i].reset();
+        animations[i].reset();
+        artboards[i].reset();
+    }
+    unref(file);
+    if (!props.path().is_empty()) file = RiveFile::Load(props.path(), sk.factory.get());
+    if (exists(file) && props.artboard() == -1 && file->get_artboard_count() > 0) {
+        props.artboard(0);
+        if (file->file->artboardAt(0)->stateMachineCount() > 0) props.scene(0);
+        else props.animation(0);
+    }
+    reinstantiate_all();
+}
+
+void RiveMultiInstance2D::instantiate(int index) {
+    machines[index].reset();
+    animations[index].reset();
+    artboards[index].reset();
+    if (!exists(file) || props.artboard() < 0 || props.artboard() >= file->get_artboard_count()) return;
+
+    auto artboard = file->file->artboardAt(props.artboard());
+    if (!artboard) return;
+    if (props.scene() >= 0 && props.scene() < artboard->stateMachineCount())
+        machines[index] = artboard->stateMachineAt(props.scene());
+    else if (props.animation() >= 0 && props.animation() < artboard->animationCount())
+        animations[index] = artboard->animationAt(props.animation());
+    artboard->advance(0);
+    artboards[index] = std::move(artboard);
+}
+
+void RiveMultiInstance2D::reinstantiate_all() {
+    // Instances that don't resolve (e.g. while file_path changes) keep their id and placement, and are skipped until
+    // a later reinstantiate gives them an artboard
+    for (size_t i = 0; i < artboards.size(); i++) instantiate(i);
+    update_transforms();
+}
+
+void RiveMultiInstance2D::update_transforms() {
+    for (size_t i = 0; i < artboards.size(); i++) update_transform(i);
+}
+
+void RiveMultiInstance2D::update_transform(int index) {
+    if (!artboards[index]) return;
+    // Each instance fits its artboard into a box of instance_size centered on its origin
+    const rive::AABB box(-instance_size.x / 2, -instance_size.y / 2, instance_size.x / 2, instance_size.y / 2);
+    rive::Mat2D fit = rive::computeAlignment(props.rive_fit(), props.rive_alignment(), box, artboards[index]->bounds());
+    transforms[index] = to_mat2d(placements[index]) * fit;
+}
+
+int RiveMultiInstance2D::index_of(int id) const {
+    return id >= 0 && id < id_to_index.size() ? id_to_index[id] : -1;
+}
+
+int RiveMultiInstance2D::add_instance(Transform2D transform) {
+    int index = artboards.size();
+    artboards.emplace_back();
+    machines.emplace_back();
+    animations.emplace_back();
+    placements.push_back(transform);
+    transforms.emplace_back();
+    speeds.push_back(1);
+    times.push_back(0);
+    instantiate(index);
+    // Before the file is loaded the instance simply waits for it; with a file, the artboard settings are wrong
+    if (!artboards[index] && exists(file))
+        RiveException("Unable to instantiate artboard.").from(this, "add_instance").warning().report();
+
+    int id;
+    if (!free_ids.empty()) {
+        id = free_ids.back();
+        free_ids.pop_back();
+        id_to_index[id] = index;
+    } else {
+        id = id_to_index.size();
+        id_to_index.push_back(index);
+    }
+    index_to_id.push_back(id);
+    update_transform(index);
+    return id;
+}
+
+void RiveMultiInstance2D::remove_instance(int id) {
+    int index = index_of(id);
+    if (index == -1) return;
+
+    // Swap-remove keeps the arrays dense
+    int last = artboards.size() - 1;
+    if (index != last) {
+        std::swap(artboards[index], artboards[last]);
+        std::swap(machines[index], machines[last]);
+        std::swap(animations[index], animations[last]);
+        std::swap(placements[index], placements[last]);
+        std::swap(transforms[index], transforms[last]);
+        std::swap(speeds[index], speeds[last]);
+        std::swap(times[index], times[last]);
+        index_to_id[index] = index_to_id[last];
+        id_to_index[index_to_id[index]] = index;
+    }
+    machines.pop_back();
+    animations.pop_back();
+    artboards.pop_back();
+    placements.pop_back();
+    transforms.pop_back();
+    speeds.pop_back();
+    times.pop_back();
+    index_to_id.pop_back();
+    id_to_index[id] = -1;
+    free_ids.push_back(id);
+}
+
+void RiveMultiInstance2D::clear_instances() {
+    machines.clear();
+    animations.clear();
+    artboards.clear();
+    placements.clear();
+    transforms.clear();
+    speeds.clear();
+    times.clear();
+    index_to_id.clear();
+    id_to_index.clear();
+    free_ids.clear();
+    render();
+}
+
+int RiveMultiInstance2D::get_instance_count() const {
+    return artboards.size();
+}
+
+bool RiveMultiInstance2D::has_instance(int id) const {
+    return index_of(id) != -1;
+}
+
+void RiveMultiInstance2D::set_instance_transform(int id, Transform2D transform) {
+    int index = index_of(id);
+    if (index == -1) return;
+    placements[index] = transform;
+    update_transform(index);
+}
+
+Transform2D RiveMultiInstance2D::get_instance_transform(int id) const {
+    int index = index_of(id);
+    return index != -1 ? placements[index] : Transform2D();
+}
+
+void RiveMultiInstance2D::set_instance_speed(int id, float speed) {
+    int index = index_of(id);
+    if (index != -1) speeds[index] = speed;
+}
+
+float RiveMultiInstance2D::get_instance_speed(int id) const {
+    int index = index_of(id);
+    return index != -1 ? speeds[index] : 0;
+}
+
+float RiveMultiInstance2D::get_instance_time(int id) const {
+    int index = index_of(id);
+    return index != -1 ? times[index] : 0;
+}
+
+void RiveMultiInstance2D::set_instance_input(int id, String name, Variant value) {
+    int index = index_of(id);
+    if (index == -1 || !machines[index]) return;
+    std::string input = name.utf8().get_data();
+    if (value.get_type() == Variant::BOOL) {
+        if (auto bool_input = machines[index]->getBool(input)) bool_input->value((bool)value);
+    } else if (auto number_input = machines[index]->getNumber(input)) {
+        number_input->value((float)value);
+    }
+}
+
+void RiveMultiInstance2D::fire_instance_trigger(int id, String name) {
+    int index = index_of(id);
+    if (index == -1 || !machines[index]) return;
+    if (auto trigger = machines[index]->getTrigger(name.utf8().get_data())) trigger->fire();
+}
+
+void RiveMultiInstance2D::set_file_path(String value) {
+    props.path(value);
+    load_file();
+}
+
+void RiveMultiInstance2D::set_artboard(int value) {
+    props.artboard(value);
+    reinstantiate_all();
+}
+
+void RiveMultiInstance2D::set_scene(int value) {
+    props.scene(value);
+    if (value != -1) props.animation(-1);
+    reinstantiate_all();
+}
+
+void RiveMultiInstance2D::set_animation(int value) {
+    props.animation(value);
+    reinstantiate_all();
+}
+
+void RiveMultiInstance2D::set_fit(int value) {
+    props.fit((FIT)value);
+    update_transforms();
+}
+
+void RiveMultiInstance2D::set_alignment(int value) {
+    props.alignment((ALIGN)value);
+    update_transforms();
+}
+
+void RiveMultiInstance2D::set_size(Vector2 value) {
+    props.size(value.x, value.y);
+    queue_redraw();
+}
+
+void RiveMultiInstance2D::set_instance_size(Vector2 value) {
+    instance_size = value;
+    update_transforms();
+}
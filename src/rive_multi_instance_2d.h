@@ -0,0 +1,142 @@
+#ifndef RIVEEXTENSION_MULTI_INSTANCE_2D_H
+#define RIVEEXTENSION_MULTI_INSTANCE_2D_H
+
+// stdlib
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/classes/node2d.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// rive-cpp
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/artboard.hpp>
+
+// extension
+#include "api/rive_file.hpp"
+#include "skia_instance.hpp"
+#include "utils/godot_macros.hpp"
+#include "utils/types.hpp"
+#include "viewer_props.hpp"
+
+using namespace godot;
+
+/**
+ * Holds many independent instances of one artboard in structure-of-arrays form and rasterizes all of them into a
+ * single surface, drawn with one texture. Instances have no node of their own: they are addressed by the id
+ * returned from add_instance().
+ */
+class RiveMultiInstance2D : public Node2D {
+    GDCLASS(RiveMultiInstance2D, Node2D);
+
+   private:
+    ViewerProps props;
+    SkiaInstance sk;
+    Ref<RiveFile> file;
+    Ref<Image> image;
+    Ref<ImageTexture> texture;
+    Vector2 instance_size = Vector2(64, 64);
+
+    /* Per-instance state, indexed densely; ids map into these through id_to_index */
+    std::vector<Ptr<rive::ArtboardInstance>> artboards;
+    std::vector<Ptr<rive::StateMachineInstance>> machines;
+    std::vector<Ptr<rive::LinearAnimationInstance>> animations;
+    std::vector<Transform2D> placements;
+    std::vector<rive::Mat2D> transforms;
+    std::vector<float> speeds;
+    std::vector<float> times;
+    std::vector<int> index_to_id;
+    std::vector<int> id_to_index;
+    std::vector<int> free_ids;
+
+    void load_file();
+    void instantiate(int index);
+    void reinstantiate_all();
+    void update_transforms();
+    void update_transform(int index);
+    int index_of(int id) const;
+    void render();
+
+   protected:
+    static void _bind_methods();
+
+   public:
+    RiveMultiInstance2D();
+
+    void _ready() override;
+    void _process(double delta) override;
+    void _draw() override;
+
+    int add_instance(Transform2D transform);
+    void remove_instance(int id);
+    void clear_instances();
+    int get_instance_count() const;
+    bool has_instance(int id) const;
+    void set_instance_transform(int id, Transform2D transform);
+    Transform2D get_instance_transform(int id) const;
+    void set_instance_speed(int id, float speed);
+    float get_instance_speed(int id) const;
+    float get_instance_time(int id) const;
+    void set_instance_input(int id, String name, Variant value);
+    void fire_instance_trigger(int id, String name);
+
+    /* Setters */
+
+    void set_file_path(String value);
+    void set_artboard(int value);
+    void set_scene(int value);
+    void set_animation(int value);
+    void set_fit(int value);
+    void set_alignment(int value);
+    void set_size(Vector2 value);
+    void set_instance_size(Vector2 value);
+
+    void set_paused(bool value) {
+        props.paused(value);
+    }
+
+    /* Getters */
+
+    String get_file_path() const {
+        return props.path();
+    }
+
+    int get_artboard() const {
+        return props.artboard();
+    }
+
+    int get_scene() const {
+        return props.scene();
+    }
+
+    int get_animation() const {
+        return props.animation();
+    }
+
+    int get_fit() const {
+        return props.fit();
+    }
+
+    int get_alignment() const {
+        return props.alignment();
+    }
+
+    Vector2 get_size() const {
+        return props.size();
+    }
+
+    Vector2 get_instance_size() const {
+        return instance_size;
+    }
+
+    bool get_paused() const {
+        return props.paused();
+    }
+};
+
+#endif
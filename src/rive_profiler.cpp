@@ -0,0 +1,93 @@
+#include "rive_profiler.h"
+
+// stdlib
+#include <algorithm>
+#include <map>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/engine_debugger.hpp>
+
+// extension
+#include "rive_stats.hpp"
+#include "rive_viewer_base.h"
+
+static double nsec_to_sec(uint64_t nsec) {
+    return nsec / 1000000000.0;
+}
+
+void RiveProfiler::_bind_methods() {}
+
+void RiveProfiler::add_frame_data() {
+    auto debugger = EngineDebugger::get_singleton();
+    if (!debugger || !debugger->is_active() || !debugger->is_profiling("servers")) return;
+
+    // The servers profiler takes a category name followed by (name, seconds) pairs
+    const RiveFrameStats &frame = RiveStats::get_singleton().frame();
+    Array stages;
+    stages.push_back("Rive");
+    stages.push_back("Load");
+    stages.push_back(nsec_to_sec(frame.load_nsec));
+    stages.push_back("Advance");
+    stages.push_back(nsec_to_sec(frame.advance_nsec));
+    stages.push_back("Raster");
+    stages.push_back(nsec_to_sec(frame.raster_nsec));
+    stages.push_back("Copy");
+    stages.push_back(nsec_to_sec(frame.copy_nsec));
+    stages.push_back("Upload");
+    stages.push_back(nsec_to_sec(frame.upload_nsec));
+    debugger->profiler_add_frame_data("servers", stages);
+
+    std::map<String, uint64_t> file_nsec;
+    for (auto &entry : RiveStats::get_singleton().get_viewers()) {
+        String path = entry.first->get_file_path();
+        if (path.is_empty()) continue;
+        auto &sample = entry.first->get_last_render_sample();
+        file_nsec[path] += sample.advance_nsec + sample.raster_nsec + sample.upload_nsec;
+    }
+    if (file_nsec.empty()) return;
+    Array files;
+    files.push_back("Rive Files");
+    for (auto &entry : file_nsec) {
+        files.push_back(entry.first.get_file());
+        files.push_back(nsec_to_sec(entry.second));
+    }
+    debugger->profiler_add_frame_data("servers", files);
+}
+
+void RiveProfiler::_toggle(bool enable, const Array &options) {
+    enabled = enable;
+    since_sent = PROFILER_VIEWER_INTERVAL;
+    if (options.size() > 0) top_viewers = std::max((int)options[0], 1);
+}
+
+void RiveProfiler::_tick(double frame_time, double process_time, double physics_time, double physics_frame_time) {
+    if (!enabled) return;
+    since_sent += frame_time;
+    if (since_sent < PROFILER_VIEWER_INTERVAL) return;
+    since_sent = 0;
+    send_viewers();
+}
+
+void RiveProfiler::send_viewers() {
+    std::vector<RiveViewerBase *> viewers;
+    for (auto &entry : RiveStats::get_singleton().get_viewers()) viewers.push_back(entry.first);
+    const size_t count = std::min(viewers.size(), (size_t)top_viewers);
+    std::partial_sort(
+        viewers.begin(), viewers.begin() + count, viewers.end(), [](RiveViewerBase *a, RiveViewerBase *b) {
+            return a->get_render_cost_ms() > b->get_render_cost_ms();
+        }
+    );
+
+    Array list;
+    for (size_t i = 0; i < count; i++) {
+        RiveViewerBase *viewer = viewers[i];
+        CanvasItem *owner = viewer->get_owner();
+        Dictionary info = viewer->get_render_stats();
+        if (owner) info["node"] = owner->is_inside_tree() ? String(owner->get_path()) : String(owner->get_name());
+        info["file"] = viewer->get_file_path();
+        info["cost_ms"] = viewer->get_render_cost_ms();
+        list.push_back(info);
+    }
+    EngineDebugger::get_singleton()->send_message("rive:viewers", list);
+}
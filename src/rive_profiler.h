@@ -0,0 +1,47 @@
+#ifndef RIVEEXTENSION_PROFILER_H
+#define RIVEEXTENSION_PROFILER_H
+
+// godot-cpp
+#include <godot_cpp/classes/engine_profiler.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+using namespace godot;
+
+// Viewers listed by the debugger tab unless it asks for another count
+static const int PROFILER_DEFAULT_TOP_VIEWERS = 10;
+// Seconds between viewer lists sent to the debugger tab
+static const double PROFILER_VIEWER_INTERVAL = 0.5;
+
+/**
+ * Reports Rive's cost to a connected debugger, including remote ones on device builds.
+ *
+ * While the editor's Profiler is running, every frame adds a "Rive" category (load, advance, raster, copy and upload
+ * time) and a "Rive Files" category (time per .riv file) to it through the built-in "servers" profiler.
+ *
+ * It is also registered as the "rive" profiler. While the Rive tab of the addons/rive_profiler debugger plugin has it
+ * enabled, it sends the most expensive viewers as "rive:viewers" messages.
+ */
+class RiveProfiler : public EngineProfiler {
+    GDCLASS(RiveProfiler, EngineProfiler);
+
+   private:
+    bool enabled = false;
+    int top_viewers = PROFILER_DEFAULT_TOP_VIEWERS;
+    double since_sent = 0;
+
+    void send_viewers();
+
+   protected:
+    static void _bind_methods();
+
+   public:
+    /* Adds the frame in progress to the editor's Profiler. Called once per frame, before the counters roll over. */
+    static void add_frame_data();
+
+    void _toggle(bool enable, const Array &options) override;
+    void _tick(double frame_time, double process_time, double physics_time, double physics_frame_time) override;
+};
+
+#endif
@@ -0,0 +1,91 @@
+#include "rive_profiler_overlay.h"
+
+// stdlib
+#include <algorithm>
+
+// godot-cpp
+#include <godot_cpp/classes/font.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/theme_db.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+
+// extension
+#include "rive_stats.hpp"
+#include "rive_viewer_base.h"
+
+static Color heat_color(double cost_ms, double budget_ms) {
+    const float t = budget_ms > 0 ? std::clamp(cost_ms / budget_ms, 0.0, 1.0) : 1.0f;
+    const Color cool(0.2, 0.9, 0.3), warm(1.0, 0.85, 0.1), hot(1.0, 0.2, 0.15);
+    return t < 0.5 ? cool.lerp(warm, t * 2) : warm.lerp(hot, (t - 0.5) * 2);
+}
+
+void RiveProfilerOverlay::_bind_methods() {
+    ADD_PROP_WITH_HINT(RiveProfilerOverlay, Variant::FLOAT, budget_ms, PROPERTY_HINT_RANGE, "0.1,33,0.1,suffix:ms");
+    ADD_PROP(RiveProfilerOverlay, Variant::BOOL, show_labels);
+    ADD_PROP_WITH_HINT(RiveProfilerOverlay, Variant::INT, font_size, PROPERTY_HINT_RANGE, "6,64,1");
+}
+
+RiveProfilerOverlay::RiveProfilerOverlay() {
+    set_z_index(RenderingServer::CANVAS_ITEM_Z_MAX);
+}
+
+void RiveProfilerOverlay::_ready() {
+    set_process(true);
+}
+
+void RiveProfilerOverlay::_process(double delta) {
+    queue_redraw();
+}
+
+void RiveProfilerOverlay::_draw() {
+    const Transform2D to_local = get_global_transform_with_canvas().affine_inverse();
+    Ref<Font> font = ThemeDB::get_singleton()->get_fallback_font();
+
+    for (auto &entry : RiveStats::get_singleton().get_viewers()) {
+        RiveViewerBase *viewer = entry.first;
+        CanvasItem *owner = viewer->get_owner();
+        if (!owner || !owner->is_inside_tree() || !owner->is_visible_in_tree()) continue;
+        if (owner->get_viewport() != get_viewport()) continue;
+
+        const double cost_ms = viewer->get_render_cost_ms();
+        const Color color = heat_color(cost_ms, budget_ms);
+        const Transform2D xform = to_local * owner->get_global_transform_with_canvas();
+        draw_set_transform_matrix(xform);
+        draw_rect(Rect2(0, 0, viewer->width(), viewer->height()), color, false);
+        draw_set_transform_matrix(Transform2D());
+        if (!show_labels || font.is_null()) continue;
+
+        Dictionary stats = viewer->get_render_stats();
+        String label = String(owner->get_name()) + "  " + String::num(cost_ms, 2) + " ms  " +
+                       String::num_int64(stats["surface_width"]) + "x" + String::num_int64(stats["surface_height"]);
+        const Vector2 size = font->get_string_size(label, HORIZONTAL_ALIGNMENT_LEFT, -1, font_size);
+        const Vector2 origin = xform.get_origin() + Vector2(2, 2);
+        draw_rect(Rect2(origin, size + Vector2(4, 0)), Color(0, 0, 0, 0.65));
+        const Vector2 baseline = origin + Vector2(2, font->get_ascent(font_size));
+        draw_string(font, baseline, label, HORIZONTAL_ALIGNMENT_LEFT, -1, font_size, color);
+    }
+}
+
+void RiveProfilerOverlay::set_budget_ms(float value) {
+    budget_ms = std::max(value, 0.1f);
+}
+
+float RiveProfilerOverlay::get_budget_ms() const {
+    return budget_ms;
+}
+
+void RiveProfilerOverlay::set_show_labels(bool value) {
+    show_labels = value;
+}
+
+bool RiveProfilerOverlay::get_show_labels() const {
+    return show_labels;
+}
+
+void RiveProfilerOverlay::set_font_size(int value) {
+    font_size = std::max(value, 1);
+}
+
+int RiveProfilerOverlay::get_font_size() const {
+    return font_size;
+}
@@ -0,0 +1,46 @@
+#ifndef RIVEEXTENSION_PROFILER_OVERLAY_H
+#define RIVEEXTENSION_PROFILER_OVERLAY_H
+
+// godot-cpp
+#include <godot_cpp/classes/node2d.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "utils/godot_macros.hpp"
+
+using namespace godot;
+
+/**
+ * Debug node that outlines every Rive viewer on its viewport, colored from green to red by the viewer's average
+ * cost per rendered frame relative to budget_ms, and labels it with the node name, cost and surface size. Drop one
+ * anywhere in a scene to find which viewers are expensive; it draws above other canvas items in its layer.
+ */
+class RiveProfilerOverlay : public Node2D {
+    GDCLASS(RiveProfilerOverlay, Node2D);
+
+   private:
+    float budget_ms = 1.0;
+    bool show_labels = true;
+    int font_size = 12;
+
+   protected:
+    static void _bind_methods();
+
+   public:
+    RiveProfilerOverlay();
+
+    void _ready() override;
+    void _process(double delta) override;
+    void _draw() override;
+
+    void set_budget_ms(float value);
+    float get_budget_ms() const;
+    void set_show_labels(bool value);
+    bool get_show_labels() const;
+    void set_font_size(int value);
+    int get_font_size() const;
+};
+
+#endif
@@ -0,0 +1,170 @@
+#include "rive_sprite_3d.h"
+
+// stdlib
+#include <cmath>
+
+// godot-cpp
+#include <godot_cpp/classes/input_event_mouse_button.hpp>
+#include <godot_cpp/classes/input_event_mouse_motion.hpp>
+#include <godot_cpp/classes/viewport.hpp>
+
+void RiveSprite3D::_bind_methods() {
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::STRING, file_path, PROPERTY_HINT_FILE, "*.riv");
+    ADD_PROP(RiveSprite3D, Variant::INT, artboard);
+    ADD_PROP(RiveSprite3D, Variant::INT, scene);
+    ADD_PROP(RiveSprite3D, Variant::INT, animation);
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::INT, fit, PROPERTY_HINT_ENUM, FitEnumPropertyHint);
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::INT, alignment, PROPERTY_HINT_ENUM, AlignEnumPropertyHint);
+    ADD_PROP(RiveSprite3D, Variant::VECTOR2, world_size);
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::INT, min_resolution, PROPERTY_HINT_RANGE, "1,4096,1");
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::INT, max_resolution, PROPERTY_HINT_RANGE, "1,4096,1");
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::FLOAT, lod_bias, PROPERTY_HINT_RANGE, "0.01,4,0.01");
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::FLOAT, lod_distance, PROPERTY_HINT_RANGE, "0,1000,0.1,suffix:m");
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::FLOAT, cull_distance, PROPERTY_HINT_RANGE, "0,10000,0.1,suffix:m");
+    ADD_PROP_WITH_HINT(RiveSprite3D, Variant::FLOAT, far_update_rate, PROPERTY_HINT_RANGE, "0.1,120,0.1,suffix:fps");
+    ADD_PROP(RiveSprite3D, Variant::BOOL, input_enabled);
+    BIND_GET(RiveSprite3D, rive_texture);
+    BIND_GET(RiveSprite3D, scene_instance);
+}
+
+void RiveSprite3D::_validate_property(PropertyInfo &property) const {
+    // The texture is the sprite's own RiveTexture, rebuilt from the properties above; a stored copy would replace it
+    if (property.name == StringName("texture")) property.usage = PROPERTY_USAGE_NONE;
+}
+
+RiveSprite3D::RiveSprite3D() {
+    rive_texture.instantiate();
+    // The sprite decides when the texture advances
+    rive_texture->set_paused(true);
+    set_texture(rive_texture);
+    update_pixel_size();
+}
+
+void RiveSprite3D::_ready() {
+    // Scenes saved before texture was hidden still carry a copy of it
+    if (get_texture() != rive_texture) set_texture(rive_texture);
+    set_process(true);
+    set_process_unhandled_input(input_enabled);
+}
+
+Camera3D *RiveSprite3D::get_camera() const {
+    Viewport *viewport = get_viewport();
+    return viewport ? viewport->get_camera_3d() : nullptr;
+}
+
+bool RiveSprite3D::is_in_frustum(Camera3D *camera) const {
+    const AABB box = get_global_transform().xform(get_aabb());
+    TypedArray<Plane> planes = camera->get_frustum();
+    for (int i = 0; i < planes.size(); i++) {
+        Plane plane = planes[i];
+        // Outside if every corner is in front of one plane (planes point out of the frustum)
+        bool outside = true;
+        for (int c = 0; c < 8 && outside; c++) outside = plane.is_point_over(box.get_endpoint(c));
+        if (outside) return false;
+    }
+    return true;
+}
+
+float RiveSprite3D::get_projected_height(Camera3D *camera, float distance) const {
+    const float viewport_height = get_viewport()->get_visible_rect().size.y;
+    const float height = world_size.y * get_global_transform().basis.get_scale().y;
+    if (camera->get_projection() == Camera3D::PROJECTION_ORTHOGONAL)
+        return height / std::max(camera->get_size(), 0.001f) * viewport_height;
+    const float half_fov = Math::deg_to_rad(camera->get_fov()) * 0.5f;
+    return height / (2 * std::max(distance, 0.001f) * std::tan(half_fov)) * viewport_height;
+}
+
+void RiveSprite3D::update_resolution(float projected_height) {
+    // Snap to powers of two so small camera moves don't resize the surface every frame
+    const float aspect = world_size.x / world_size.y;
+    const float longest = projected_height * lod_bias * std::max(aspect, 1.0f);
+    int target = min_resolution;
+    while (target < longest && target < max_resolution) target <<= 1;
+    target = std::clamp(target, min_resolution, max_resolution);
+
+    Vector2i resolution = aspect >= 1 ? Vector2i(target, std::max(1, (int)std::round(target / aspect)))
+                                      : Vector2i(std::max(1, (int)std::round(target * aspect)), target);
+    if (resolution == rive_texture->get_resolution()) return;
+    rive_texture->set_resolution(resolution);
+    update_pixel_size();
+}
+
+void RiveSprite3D::update_pixel_size() {
+    set_pixel_size(world_size.y / rive_texture->get_resolution().y);
+}
+
+void RiveSprite3D::_process(double delta) {
+    pending_delta += delta;
+    since_update += delta;
+    if (!is_visible_in_tree()) return;
+
+    Camera3D *camera = get_camera();
+    if (!camera) {
+        // No camera (e.g. editor preview without one): render at full detail
+        rive_texture->step(pending_delta);
+        pending_delta = 0;
+        since_update = 0;
+        return;
+    }
+
+    const float distance = camera->get_global_position().distance_to(get_global_position());
+    if (cull_distance > 0 && distance > cull_distance) return;
+    if (!is_in_frustum(camera)) return;
+
+    // Full rate up to lod_distance, easing down to far_update_rate at cull_distance
+    float interval = 0;
+    if (distance > lod_distance) {
+        const float range = std::max(cull_distance - lod_distance, 0.001f);
+        const float t = cull_distance > 0 ? std::clamp((distance - lod_distance) / range, 0.0f, 1.0f) : 1.0f;
+        interval = t / far_update_rate;
+    }
+    if (since_update < interval) return;
+
+    update_resolution(get_projected_height(camera, distance));
+    rive_texture->step(pending_delta);
+    pending_delta = 0;
+    since_update = 0;
+}
+
+bool RiveSprite3D::ray_to_texture(Vector3 origin, Vector3 direction, Vector2 &out) const {
+    const Transform3D inverse = get_global_transform().affine_inverse();
+    const Vector3 local_origin = inverse.xform(origin);
+    const Vector3 local_direction = inverse.basis.xform(direction);
+    if (std::abs(local_direction.z) < 1e-6f) return false;
+
+    // The quad lies in the local XY plane, centred on the origin
+    const float t = -local_origin.z / local_direction.z;
+    if (t < 0) return false;
+    const Vector3 hit = local_origin + local_direction * t;
+    const Vector2i resolution = rive_texture->get_resolution();
+    const float u = hit.x / world_size.x + 0.5f;
+    const float v = 0.5f - hit.y / world_size.y;
+    if (u < 0 || u > 1 || v < 0 || v > 1) return false;
+    out = Vector2(u * resolution.x, v * resolution.y);
+    return true;
+}
+
+void RiveSprite3D::_unhandled_input(const Ref<InputEvent> &event) {
+    auto mouse_event = dynamic_cast<InputEventMouse *>(event.ptr());
+    if (!input_enabled || !mouse_event || !is_visible_in_tree()) return;
+    Camera3D *camera = get_camera();
+    if (!camera) return;
+
+    const Vector2 screen = mouse_event->get_position();
+    Vector2 position;
+    bool hit = ray_to_texture(camera->project_ray_origin(screen), camera->project_ray_normal(screen), position);
+    if (hit) pointer_position = position;
+
+    if (auto mouse_button = dynamic_cast<InputEventMouseButton *>(event.ptr())) {
+        if (mouse_button->is_pressed() && hit) {
+            pointer_down = true;
+            rive_texture->press_mouse(position);
+        } else if (mouse_button->is_released() && pointer_down) {
+            pointer_down = false;
+            // Releases off the quad still end the press
+            rive_texture->release_mouse(pointer_position);
+        }
+    } else if (dynamic_cast<InputEventMouseMotion *>(event.ptr()) && hit) {
+        rive_texture->move_mouse(position);
+    }
+}
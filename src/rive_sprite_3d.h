@@ -0,0 +1,192 @@
+#ifndef RIVEEXTENSION_SPRITE_3D_H
+#define RIVEEXTENSION_SPRITE_3D_H
+
+// stdlib
+#include <algorithm>
+
+// godot-cpp
+#include <godot_cpp/classes/camera3d.hpp>
+#include <godot_cpp/classes/input_event.hpp>
+#include <godot_cpp/classes/sprite3d.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "rive_texture.h"
+#include "utils/godot_macros.hpp"
+
+using namespace godot;
+
+/**
+ * Shows a Rive artboard on a world-space quad. Raster resolution follows the quad's projected screen size, and the
+ * update rate drops with camera distance. Nothing is rasterized beyond cull_distance or outside the camera frustum.
+ *
+ * The quad keeps world_size whatever resolution is picked. Mouse rays that hit the quad are forwarded to the state
+ * machine as pointer events; billboard modes are not accounted for when hit testing.
+ */
+class RiveSprite3D : public Sprite3D {
+    GDCLASS(RiveSprite3D, Sprite3D);
+
+   private:
+    Ref<RiveTexture> rive_texture;
+    Vector2 world_size = Vector2(1, 1);
+    int min_resolution = 32;
+    int max_resolution = 1024;
+    float lod_bias = 1;
+    float lod_distance = 10;
+    float cull_distance = 100;
+    float far_update_rate = 10;
+    bool input_enabled = true;
+
+    float pending_delta = 0;
+    float since_update = 0;
+    bool pointer_down = false;
+    Vector2 pointer_position;
+
+    Camera3D *get_camera() const;
+    bool is_in_frustum(Camera3D *camera) const;
+    float get_projected_height(Camera3D *camera, float distance) const;
+    void update_resolution(float projected_height);
+    void update_pixel_size();
+    bool ray_to_texture(Vector3 origin, Vector3 direction, Vector2 &out) const;
+
+   protected:
+    static void _bind_methods();
+    void _validate_property(PropertyInfo &property) const;
+
+   public:
+    RiveSprite3D();
+
+    void _ready() override;
+    void _process(double delta) override;
+    void _unhandled_input(const Ref<InputEvent> &event) override;
+
+    Ref<RiveTexture> get_rive_texture() const {
+        return rive_texture;
+    }
+
+    Ref<RiveScene> get_scene_instance() const {
+        return rive_texture->get_scene_instance();
+    }
+
+    /* Setters */
+
+    void set_file_path(String value) {
+        rive_texture->set_file_path(value);
+    }
+
+    void set_artboard(int value) {
+        rive_texture->set_artboard(value);
+    }
+
+    void set_scene(int value) {
+        rive_texture->set_scene(value);
+    }
+
+    void set_animation(int value) {
+        rive_texture->set_animation(value);
+    }
+
+    void set_fit(int value) {
+        rive_texture->set_fit(value);
+    }
+
+    void set_alignment(int value) {
+        rive_texture->set_alignment(value);
+    }
+
+    void set_world_size(Vector2 value) {
+        world_size = Vector2(std::max(value.x, 0.001f), std::max(value.y, 0.001f));
+        update_pixel_size();
+    }
+
+    void set_min_resolution(int value) {
+        min_resolution = std::max(value, 1);
+    }
+
+    void set_max_resolution(int value) {
+        max_resolution = std::max(value, 1);
+    }
+
+    void set_lod_bias(float value) {
+        lod_bias = std::max(value, 0.01f);
+    }
+
+    void set_lod_distance(float value) {
+        lod_distance = std::max(value, 0.0f);
+    }
+
+    void set_cull_distance(float value) {
+        cull_distance = std::max(value, 0.0f);
+    }
+
+    void set_far_update_rate(float value) {
+        far_update_rate = std::max(value, 0.1f);
+    }
+
+    void set_input_enabled(bool value) {
+        input_enabled = value;
+        set_process_unhandled_input(value);
+    }
+
+    /* Getters */
+
+    String get_file_path() const {
+        return rive_texture->get_file_path();
+    }
+
+    int get_artboard() const {
+        return rive_texture->get_artboard();
+    }
+
+    int get_scene() const {
+        return rive_texture->get_scene();
+    }
+
+    int get_animation() const {
+        return rive_texture->get_animation();
+    }
+
+    int get_fit() const {
+        return rive_texture->get_fit();
+    }
+
+    int get_alignment() const {
+        return rive_texture->get_alignment();
+    }
+
+    Vector2 get_world_size() const {
+        return world_size;
+    }
+
+    int get_min_resolution() const {
+        return min_resolution;
+    }
+
+    int get_max_resolution() const {
+        return max_resolution;
+    }
+
+    float get_lod_bias() const {
+        return lod_bias;
+    }
+
+    float get_lod_distance() const {
+        return lod_distance;
+    }
+
+    float get_cull_distance() const {
+        return cull_distance;
+    }
+
+    float get_far_update_rate() const {
+        return far_update_rate;
+    }
+
+    bool get_input_enabled() const {
+        return input_enabled;
+    }
+};
+
+#endif
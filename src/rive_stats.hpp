@@ -0,0 +1,116 @@
+#ifndef _RIVEEXTENSION_RIVE_STATS_HPP_
+#define _RIVEEXTENSION_RIVE_STATS_HPP_
+
+// stdlib
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+class RiveViewerBase;
+
+enum VIEWER_STATE { VIEWER_ACTIVE = 0, VIEWER_SLEEPING = 1, VIEWER_CULLED = 2 };
+
+/* Cost of one engine frame, summed over every viewer. Times are in nanoseconds. */
+struct RiveFrameStats {
+    uint64_t load_nsec = 0;
+    uint64_t advance_nsec = 0;
+    uint64_t raster_nsec = 0;
+    uint64_t copy_nsec = 0;
+    uint64_t upload_nsec = 0;
+    uint64_t uploaded_bytes = 0;
+    int reinstantiations = 0;
+};
+
+/**
+ * Adds the time until it goes out of scope to a nanosecond counter, and optionally to a second one (e.g. a viewer's
+ * own). Samples are kept at full resolution, since many are shorter than a microsecond; readers convert.
+ */
+struct ScopedTimer {
+    uint64_t &target;
+    uint64_t *also;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    ScopedTimer(uint64_t &target_value, uint64_t *also_value = nullptr) : target(target_value), also(also_value) {}
+
+    ~ScopedTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        uint64_t nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        target += nsec;
+        if (also) *also += nsec;
+    }
+};
+
+/**
+ * Process-wide counters behind the Rive performance monitors (see RiveMonitors). Recording is a few additions on the
+ * main thread, so it is always on. Frame counters roll over at the end of each drawn frame; viewers register
+ * themselves and report whether they rendered, slept or were culled.
+ */
+class RiveStats {
+   private:
+    RiveFrameStats current, last;
+    std::unordered_map<RiveViewerBase *, VIEWER_STATE> viewers;
+    uint64_t file_bytes = 0;
+    int file_count = 0;
+
+   public:
+    static RiveStats &get_singleton() {
+        static RiveStats singleton;
+        return singleton;
+    }
+
+    /* Counters of the frame in progress. */
+    RiveFrameStats &frame() {
+        return current;
+    }
+
+    /* Counters of the last finished frame. */
+    const RiveFrameStats &last_frame() const {
+        return last;
+    }
+
+    void end_frame() {
+        last = current;
+        current = RiveFrameStats();
+    }
+
+    void set_viewer_state(RiveViewerBase *viewer, VIEWER_STATE state) {
+        viewers[viewer] = state;
+    }
+
+    void remove_viewer(RiveViewerBase *viewer) {
+        viewers.erase(viewer);
+    }
+
+    /* Every live viewer and its state in the last process frame. */
+    const std::unordered_map<RiveViewerBase *, VIEWER_STATE> &get_viewers() const {
+        return viewers;
+    }
+
+    int count_viewers(VIEWER_STATE state) const {
+        int count = 0;
+        for (auto &entry : viewers)
+            if (entry.second == state) count++;
+        return count;
+    }
+
+    /* Imported files are measured by their .riv size, since the runtime doesn't report what an import allocates. */
+    void file_imported(uint64_t bytes) {
+        file_bytes += bytes;
+        file_count++;
+    }
+
+    void file_released(uint64_t bytes) {
+        file_bytes -= bytes;
+        file_count--;
+    }
+
+    uint64_t get_file_bytes() const {
+        return file_bytes;
+    }
+
+    int get_file_count() const {
+        return file_count;
+    }
+};
+
+#endif
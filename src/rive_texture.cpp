@@ -0,0 +1,155 @@
+#include "rive_texture.h"
+
+// godot-cpp
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
+
+// extension
+#include "offscreen_instance.hpp"
+#include "rive_exceptions.hpp"
+#include "utils/memory.hpp"
+
+// Longer gaps (breakpoints, window drags) are clamped so animations don't jump
+static const float TEXTURE_MAX_DELTA = 0.1f;
+
+/* The scene tree's last process delta, which includes Engine.time_scale; 0 while the tree is paused. */
+static float process_delta() {
+    auto tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+    if (!tree || tree->is_paused() || !tree->get_root()) return 0;
+    return std::min((float)tree->get_root()->get_process_delta_time(), TEXTURE_MAX_DELTA);
+}
+
+void RiveTexture::_bind_methods() {
+    ADD_PROP_WITH_HINT(RiveTexture, Variant::STRING, file_path, PROPERTY_HINT_FILE, "*.riv");
+    ADD_PROP(RiveTexture, Variant::INT, artboard);
+    ADD_PROP(RiveTexture, Variant::INT, scene);
+    ADD_PROP(RiveTexture, Variant::INT, animation);
+    ADD_PROP(RiveTexture, Variant::VECTOR2I, resolution);
+    ADD_PROP_WITH_HINT(RiveTexture, Variant::INT, fit, PROPERTY_HINT_ENUM, FitEnumPropertyHint);
+    ADD_PROP_WITH_HINT(RiveTexture, Variant::INT, alignment, PROPERTY_HINT_ENUM, AlignEnumPropertyHint);
+    ADD_PROP(RiveTexture, Variant::BOOL, paused);
+    ADD_PROP(RiveTexture, Variant::FLOAT, speed);
+    ClassDB::bind_method(D_METHOD("render_now", "delta"), &RiveTexture::render_now);
+    ClassDB::bind_method(D_METHOD("get_scene_instance"), &RiveTexture::get_scene_instance);
+    ClassDB::bind_method(D_METHOD("press_mouse", "position"), &RiveTexture::press_mouse);
+    ClassDB::bind_method(D_METHOD("release_mouse", "position"), &RiveTexture::release_mouse);
+    ClassDB::bind_method(D_METHOD("move_mouse", "position"), &RiveTexture::move_mouse);
+    ClassDB::bind_method(D_METHOD("_frame"), &RiveTexture::_frame);
+}
+
+void RiveTexture::_validate_property(PropertyInfo &property) const {
+    // Frames are regenerated from the .riv, so they are never stored with the resource
+    if (property.name == StringName("image")) property.usage = PROPERTY_USAGE_NONE;
+}
+
+RiveTexture::RiveTexture() {
+    // Blank until the first frame, so users always see a valid texture of the right size
+    image = Image::create(resolution.x, resolution.y, false, Image::FORMAT_RGBA8);
+    set_image(image);
+
+    auto rs = RenderingServer::get_singleton();
+    if (rs) {
+        rs->connect("frame_pre_draw", Callable(this, "_frame"));
+        connected = true;
+    }
+}
+
+RiveTexture::~RiveTexture() {
+    auto rs = RenderingServer::get_singleton();
+    if (connected && rs) rs->disconnect("frame_pre_draw", Callable(this, "_frame"));
+}
+
+void RiveTexture::reload() {
+    dirty = false;
+    offscreen.reset();
+    if (file_path.is_empty()) return;
+
+    auto instance = std::make_unique<OffscreenInstance>();
+    bool loaded = instance->load(
+        file_path, artboard, scene, animation, resolution.x, resolution.y, (FIT)fit, (ALIGN)alignment
+    );
+    if (!loaded) {
+        RiveException("Unable to load <" + file_path + ">").from(this, "reload").report();
+        return;
+    }
+    offscreen = std::move(instance);
+    upload(offscreen->render());
+}
+
+void RiveTexture::reselect() {
+    if (!offscreen || dirty) return;
+    // An invalid selection goes through a full reload, which reports it
+    if (!offscreen->select(artboard, scene, animation)) {
+        dirty = true;
+        return;
+    }
+    upload(offscreen->render());
+}
+
+void RiveTexture::relayout() {
+    if (!offscreen || dirty) return;
+    offscreen->layout((FIT)fit, (ALIGN)alignment);
+    upload(offscreen->render());
+}
+
+void RiveTexture::upload(const PackedByteArray &bytes) {
+    const int w = offscreen->width(), h = offscreen->height();
+    if (bytes.size() != w * h * 4) return;
+    if (image->get_width() != w || image->get_height() != h) {
+        image = Image::create_from_data(w, h, false, Image::FORMAT_RGBA8, bytes);
+        set_image(image);
+    } else {
+        image->set_data(w, h, false, Image::FORMAT_RGBA8, bytes);
+        update(image);
+    }
+}
+
+void RiveTexture::_frame() {
+    if (dirty) reload();
+    if (!paused) step(process_delta());
+}
+
+bool RiveTexture::step(float delta) {
+    if (dirty) reload();
+    if (!offscreen || !offscreen->advance(delta * speed)) return false;
+    upload(offscreen->render());
+    return true;
+}
+
+void RiveTexture::set_resolution(Vector2i value) {
+    value = Vector2i(std::max(value.x, 1), std::max(value.y, 1));
+    if (value == resolution) return;
+    resolution = value;
+    if (!offscreen || dirty) {
+        dirty = true;
+        return;
+    }
+    // Resize in place so LOD changes don't restart the animation
+    offscreen->resize(resolution.x, resolution.y);
+    upload(offscreen->render());
+}
+
+void RiveTexture::press_mouse(Vector2 position) {
+    if (offscreen) offscreen->press_mouse(position);
+}
+
+void RiveTexture::release_mouse(Vector2 position) {
+    if (offscreen) offscreen->release_mouse(position);
+}
+
+void RiveTexture::move_mouse(Vector2 position) {
+    if (offscreen) offscreen->move_mouse(position);
+}
+
+void RiveTexture::render_now(float delta) {
+    if (dirty) reload();
+    if (!offscreen) return;
+    offscreen->advance(delta * speed);
+    upload(offscreen->render());
+}
+
+Ref<RiveScene> RiveTexture::get_scene_instance() const {
+    return offscreen ? offscreen->scene() : nullptr;
+}
@@ -0,0 +1,160 @@
+#ifndef RIVEEXTENSION_TEXTURE_H
+#define RIVEEXTENSION_TEXTURE_H
+
+// stdlib
+#include <algorithm>
+#include <memory>
+
+// godot-cpp
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/core/binder_common.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "api/rive_scene.hpp"
+#include "utils/godot_macros.hpp"
+#include "viewer_props.hpp"
+
+using namespace godot;
+
+class OffscreenInstance;
+
+/**
+ * A texture that plays a Rive artboard by itself. It can be assigned anywhere a Texture2D is accepted (TextureRect,
+ * Sprite2D/3D, materials, shader uniforms) without a SubViewport or a viewer node.
+ *
+ * The texture advances and uploads at most once per frame, just before the frame is drawn, however many users
+ * share it.
+ */
+class RiveTexture : public ImageTexture {
+    GDCLASS(RiveTexture, ImageTexture);
+
+   private:
+    String file_path;
+    int artboard = 0;
+    int scene = -1;
+    int animation = 0;
+    Vector2i resolution = Vector2i(256, 256);
+    int fit = FIT::CONTAIN;
+    int alignment = ALIGN::CENTER;
+    bool paused = false;
+    float speed = 1;
+
+    std::unique_ptr<OffscreenInstance> offscreen;
+    Ref<Image> image;
+    // Set when file_path changes: the file is imported again on the next update
+    bool dirty = true;
+    bool connected = false;
+
+    void reload();
+    void reselect();
+    void relayout();
+    void upload(const PackedByteArray &bytes);
+
+   protected:
+    static void _bind_methods();
+    void _validate_property(PropertyInfo &property) const;
+
+   public:
+    RiveTexture();
+    ~RiveTexture();
+
+    void _frame();
+
+    /* Advances by delta and uploads immediately, independent of the per-frame update. */
+    void render_now(float delta);
+
+    /* Advances by delta and uploads only if the artboard changed. Returns true if it uploaded. */
+    bool step(float delta);
+
+    /* Pointer positions are in texture pixels. */
+    void press_mouse(Vector2 position);
+    void release_mouse(Vector2 position);
+    void move_mouse(Vector2 position);
+    Ref<RiveScene> get_scene_instance() const;
+
+    /* Setters */
+
+    void set_file_path(String value) {
+        if (value == file_path) return;
+        file_path = value;
+        dirty = true;
+    }
+
+    void set_artboard(int value) {
+        artboard = value;
+        reselect();
+    }
+
+    void set_scene(int value) {
+        scene = value;
+        reselect();
+    }
+
+    void set_animation(int value) {
+        animation = value;
+        reselect();
+    }
+
+    void set_resolution(Vector2i value);
+
+    void set_fit(int value) {
+        fit = value;
+        relayout();
+    }
+
+    void set_alignment(int value) {
+        alignment = value;
+        relayout();
+    }
+
+    void set_paused(bool value) {
+        paused = value;
+    }
+
+    void set_speed(float value) {
+        speed = value;
+    }
+
+    /* Getters */
+
+    String get_file_path() const {
+        return file_path;
+    }
+
+    int get_artboard() const {
+        return artboard;
+    }
+
+    int get_scene() const {
+        return scene;
+    }
+
+    int get_animation() const {
+        return animation;
+    }
+
+    Vector2i get_resolution() const {
+        return resolution;
+    }
+
+    int get_fit() const {
+        return fit;
+    }
+
+    int get_alignment() const {
+        return alignment;
+    }
+
+    bool get_paused() const {
+        return paused;
+    }
+
+    float get_speed() const {
+        return speed;
+    }
+};
+
+#endif
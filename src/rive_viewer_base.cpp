@@ -1,12 +1,14 @@
 #include "rive_viewer_base.h"
 
 #include <algorithm>
+#include <cmath>
 
 // godot-cpp
 #include <godot_cpp/classes/control.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/rendering_device.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
+#include <godot_cpp/classes/shader.hpp>
 #include <godot_cpp/classes/display_server.hpp>
 #include <godot_cpp/classes/window.hpp>
 #include <godot_cpp/core/binder_common.hpp>
@@ -14,6 +16,7 @@
 #include <godot_cpp/variant/utility_functions.hpp>
 
 #include "include/core/SkCanvas.h"
+#include "include/core/SkPictureRecorder.h"
 
 // rive-cpp
 #include <rive/animation/linear_animation.hpp>
@@ -21,10 +24,27 @@
 
 // extension
 #include "rive_exceptions.hpp"
+#include "rive_instance_pool.h"
+#include "rive_stats.hpp"
+#include "tiled_raster.hpp"
 #include "utils/godot_macros.hpp"
+#include "utils/trace.hpp"
 #include "utils/types.hpp"
 
-const Image::Format IMAGE_FORMAT = Image::Format::FORMAT_RGBA8;
+// Mask output holds coverage in the red channel; the tint comes from the vertex color, which includes modulate
+static const char *MASK_SHADER_CODE = R"(
+shader_type canvas_item;
+
+varying vec4 tint;
+
+void vertex() {
+    tint = COLOR;
+}
+
+void fragment() {
+    COLOR = vec4(tint.rgb, tint.a * texture(TEXTURE, UV).r);
+}
+)";
 
 RiveViewerBase::RiveViewerBase(CanvasItem *owner) {
     this->owner = owner;
@@ -36,6 +56,13 @@ RiveViewerBase::RiveViewerBase(CanvasItem *owner) {
     props.on_path_changed([this](String path) { _on_path_changed(path); });
     props.on_size_changed([this](float w, float h) { _on_size_changed(w, h); });
     props.on_transform_changed([this]() { _on_transform_changed(); });
+    RiveStats::get_singleton().set_viewer_state(this, VIEWER_SLEEPING);
+}
+
+RiveViewerBase::~RiveViewerBase() {
+    RiveStats::get_singleton().remove_viewer(this);
+    release_atlas_slot();
+    release_pooled_file();
 }
 
 void RiveViewerBase::on_input_event(const Ref<InputEvent> &event) {
@@ -63,27 +90,62 @@ void RiveViewerBase::on_input_event(const Ref<InputEvent> &event) {
 }
 
 void RiveViewerBase::on_draw() {
-    if (!is_null(texture)) owner->draw_texture_rect(texture, Rect2(0, 0, width(), height()), false);
+    // Godot has no notification for a new node material, and it overwrites the blend material when assigned
+    if (owner->get_material() != user_material) update_blend_material();
+    // The canvas backend draws through its own child canvas items
+    if (use_canvas()) return;
+    if (flipbook && use_flipbook()) {
+        Rect2 region = flipbook->region(std::max(flipbook_frame, 0));
+        owner->draw_texture_rect_region(flipbook->atlas, Rect2(0, 0, width(), height()), region);
+    } else if (sync && use_sync_group() && !is_null(sync->texture)) {
+        owner->draw_texture_rect(sync->texture, Rect2(0, 0, width(), height()), false);
+    } else if (atlas_slot.is_valid() && use_atlas()) {
+        auto &atlas = TextureAtlas::get_singleton();
+        atlas.flush();
+        owner->draw_texture_rect_region(atlas.texture(atlas_slot), Rect2(0, 0, width(), height()), atlas_slot.rect);
+    } else if (use_tiles()) {
+        tiles.draw(owner);
+    } else if (!is_null(texture)) {
+        owner->draw_texture_rect(texture, Rect2(0, 0, width(), height()), false);
+    }
 }
 
 void RiveViewerBase::on_process(double delta) {
+    auto &stats = RiveStats::get_singleton();
     if (props.paused()) {
+        stats.set_viewer_state(this, VIEWER_SLEEPING);
+        render_stats.end_frame(false);
         return;
     }
 
-    PackedByteArray bytes = frame(delta);
-    if (bytes.is_empty()) {
-        return;
-    }
-
-    // Update the image and texture with the new frame data
-    if (!is_null(image) && !is_null(texture)) {
-        image->set_data(width(), height(), false, IMAGE_FORMAT, bytes);
-        texture->update(image);
+    bool rendered = false;
+    bool culled = false;
+    switch (props.update_mode()) {
+        case UPDATE_MODE::UPDATE_ALWAYS:
+            rendered = frame(delta, true);
+            break;
+        case UPDATE_MODE::UPDATE_WHEN_VISIBLE:
+            culled = !owner->is_visible_in_tree();
+            if (!culled) rendered = frame(delta, true);
+            break;
+        case UPDATE_MODE::UPDATE_ONCE:
+            // Keeps trying until something was actually drawn, e.g. once the file has loaded
+            rendered = frame(delta, true);
+            if (rendered) {
+                rendered_once = true;
+                update_processing();
+            }
+            break;
+        case UPDATE_MODE::UPDATE_MANUAL:
+            break;
+        case UPDATE_MODE::UPDATE_WHEN_CHANGED:
+        default:
+            culled = !owner->is_visible_in_tree();
+            if (!culled) rendered = frame(delta);
+            break;
     }
-
-    // frame() already calls advance(), so we don't need to call it again
-    owner->queue_redraw();
+    stats.set_viewer_state(this, culled ? VIEWER_CULLED : rendered ? VIEWER_ACTIVE : VIEWER_SLEEPING);
+    render_stats.end_frame(rendered);
 }
 
 void RiveViewerBase::on_ready() {
@@ -91,6 +153,13 @@ void RiveViewerBase::on_ready() {
     int w = width();
     int h = height();
     props.size(w, h);
+    update_processing();
+}
+
+void RiveViewerBase::update_processing() {
+    // Manual viewers are driven through render_now(), so they shouldn't pay for a process callback at all
+    const UPDATE_MODE mode = props.update_mode();
+    owner->set_process(mode != UPDATE_MODE::UPDATE_MANUAL && !(mode == UPDATE_MODE::UPDATE_ONCE && rendered_once));
 }
 
 void RiveViewerBase::check_scene_property_changed() {
@@ -117,8 +186,18 @@ int RiveViewerBase::height() const {
 }
 
 void RiveViewerBase::_on_path_changed(String path) {
+    reset_rendered_once();
+    tiles.clear();
+    static_layer.clear();
+    update_trace_context();
+    RIVE_TRACE(TRACE_LOAD, inst.trace_context);
+    ScopedTimer timer(RiveStats::get_singleton().frame().load_nsec);
     try {
-        inst.file = RiveFile::Load(path, sk.factory.get());
+        auto pool = RiveInstancePool::get_singleton();
+        // Pooled files are imported for the raster backend
+        if (use_canvas()) inst.file = RiveFile::Load(path, &CanvasFactory::get_singleton());
+        else if (props.use_pool() && pool) inst.file = pooled_file = pool->acquire(path);
+        else inst.file = RiveFile::Load(path, sk.factory.get());
     } catch (RiveException error) {
         error.report();
     }
@@ -139,6 +218,7 @@ void RiveViewerBase::_on_path_changed(String path) {
             }
         }
 
+        update_trace_context();
         if (is_editor_hint()) owner->notify_property_list_changed();
     }
 }
@@ -166,6 +246,9 @@ void RiveViewerBase::get_property_list(List<PropertyInfo> *list) const {
 }
 
 void RiveViewerBase::_on_artboard_changed(int _index) {
+    reset_rendered_once();
+    tiles.clear();
+    update_trace_context();
     owner->notify_property_list_changed();
 }
 
@@ -225,89 +308,408 @@ bool RiveViewerBase::on_get(const StringName &prop, Variant &return_value) const
 }
 
 void RiveViewerBase::_on_size_changed(float w, float h) {
+    RIVE_TRACE(TRACE_PROPERTY_FLUSH, inst.trace_context);
+    release_atlas_slot();
     if (!is_null(image)) {
         unref(image);
     }
     if (!is_null(texture)) {
         unref(texture);
     }
+    // The canvas backend has nothing to upload
+    if (use_canvas()) return;
 
-    image = Image::create(width(), height(), false, IMAGE_FORMAT);
+    image = Image::create(width(), height(), false, sk.image_format());
     texture = ImageTexture::create_from_image(image);
 }
 
 void RiveViewerBase::_on_transform_changed() {
+    RIVE_TRACE(TRACE_PROPERTY_FLUSH, inst.trace_context);
     inst.current_transform = inst.get_transform();
+    reset_flipbook();
+    reset_sync_group();
 
     // 变换由 redraw() 内统一在绘制前应用，避免重复/累积
 
-    PackedByteArray bytes = redraw();
-    if (bytes.size() > 0 && !is_null(image) && !is_null(texture)) {
-        int expected_size = width() * height() * 4; // RGBA8 = 4 bytes per pixel
-        if (bytes.size() == expected_size) {
-            image->set_data(width(), height(), false, Image::FORMAT_RGBA8, bytes);
-            texture->set_image(image);
-            owner->queue_redraw();
-        }
-    }
+    upload(redraw());
 }
 
 bool RiveViewerBase::advance(float delta) {
     elapsed += delta;
+    ScopedTimer timer(RiveStats::get_singleton().frame().advance_nsec, &render_stats.sample().advance_nsec);
     bool result = inst.advance(delta);
     return result;
 }
 
 PackedByteArray RiveViewerBase::redraw() {
+    if (use_canvas()) {
+        RIVE_TRACE(TRACE_RASTER, inst.trace_context);
+        ScopedTimer timer(RiveStats::get_singleton().frame().raster_nsec, &render_stats.sample().raster_nsec);
+        draw_canvas();
+        return PackedByteArray();
+    }
+
+    if (use_tiles()) {
+        redraw_tiles();
+        return PackedByteArray();
+    }
+
+    // Rasterizing and reading back are timed separately
+    if (!raster()) return PackedByteArray();
+    RIVE_TRACE(TRACE_COPY, inst.trace_context);
+    ScopedTimer timer(render_stats.sample().upload_nsec);
+    PackedByteArray bytes = sk.bytes();
+    return bytes;
+}
+
+bool RiveViewerBase::raster() {
     auto artboard = inst.artboard();
+    if (!sk.surface || !sk.renderer || (!exists(artboard) && inst.composer.empty())) return false;
 
-    if (sk.surface && sk.renderer && exists(artboard)) {
-        // 确保每次绘制前将 Canvas 矩阵重置到单位矩阵，避免上一次变换累积
-        SkCanvas *canvas = sk.surface->getCanvas();
-        if (canvas) {
-            canvas->resetMatrix();
-        }
-        // 应用当前对齐/缩放变换
-        if (sk.renderer) {
-            sk.renderer->transform(inst.current_transform);
-        }
-        sk.clear();
-        inst.draw(sk.renderer.get());
-        PackedByteArray bytes = sk.bytes();
-        return bytes;
+    RIVE_TRACE(TRACE_RASTER, inst.trace_context);
+    ScopedTimer timer(RiveStats::get_singleton().frame().raster_nsec, &render_stats.sample().raster_nsec);
+    if (TiledRaster::get_singleton().should_tile(width(), height())) return raster_tiled();
+    if (props.static_layer_cache()) {
+        raster_static();
+        return true;
     }
 
-    return PackedByteArray();
+    // 确保每次绘制前将 Canvas 矩阵重置到单位矩阵，避免上一次变换累积
+    SkCanvas *canvas = sk.surface->getCanvas();
+    if (canvas) {
+        canvas->resetMatrix();
+    }
+    sk.clear(covers_surface());
+    // 应用当前对齐/缩放变换
+    sk.renderer->save();
+    sk.renderer->transform(inst.current_transform);
+    inst.draw(sk.renderer.get());
+    sk.renderer->restore();
+    // Composed artboards are placed in surface space
+    inst.composer.draw(sk.renderer.get());
+    return true;
+}
+
+bool RiveViewerBase::covers_surface() const {
+    auto artboard = inst.artboard();
+    if (!exists(artboard) || !artboard->is_opaque()) return false;
+    const Rect2 bounds = artboard->get_bounds();
+    const rive::Vec2D a = inst.current_transform * rive::Vec2D(bounds.position.x, bounds.position.y);
+    const rive::Vec2D b = inst.current_transform * rive::Vec2D(bounds.get_end().x, bounds.get_end().y);
+    return std::min(a.x, b.x) <= 0 && std::min(a.y, b.y) <= 0 && std::max(a.x, b.x) >= width() &&
+           std::max(a.y, b.y) >= height();
 }
 
-PackedByteArray RiveViewerBase::frame(float delta) {
-    if (!owner->is_visible_in_tree()) {
-        return PackedByteArray();
+sk_sp<SkPicture> RiveViewerBase::record_frame() {
+    SkPictureRecorder recorder;
+    SkiaRenderer renderer(recorder.beginRecording(SkRect::MakeWH(width(), height())));
+    renderer.save();
+    renderer.transform(inst.current_transform);
+    inst.draw(&renderer);
+    renderer.restore();
+    inst.composer.draw(&renderer);
+    return recorder.finishRecordingAsPicture();
+}
+
+bool RiveViewerBase::raster_tiled() {
+    // Record once on this thread, then rasterize strips of the surface in parallel
+    return TiledRaster::get_singleton().play(sk.surface.get(), record_frame());
+}
+
+void RiveViewerBase::raster_static() {
+    static_layer.draw(sk.surface.get(), record_frame());
+}
+
+bool RiveViewerBase::use_tiles() const {
+    // Composed artboards are placed in viewer space, so they can't be cut into artboard tiles
+    return props.has_view_rect() && !use_canvas() && inst.composer.empty() &&
+           props.output_format() == OUTPUT_FORMAT::OUTPUT_RGBA8;
+}
+
+bool RiveViewerBase::redraw_tiles() {
+    auto artboard = inst.artboard();
+    if (!exists(artboard)) return false;
+    Rect2 bounds = artboard->get_bounds();
+    // The viewer's own cost covers the whole update, tile uploads included
+    RIVE_TRACE(TRACE_RASTER, inst.trace_context);
+    ScopedTimer viewer_timer(render_stats.sample().raster_nsec);
+    tiles.set_alpha_type(props.premultiplied_alpha() ? kPremul_SkAlphaType : kUnpremul_SkAlphaType);
+    sk_sp<SkPicture> picture;
+    {
+        // Tiles time their own rasterization and upload
+        ScopedTimer timer(RiveStats::get_singleton().frame().raster_nsec);
+        picture = TileCache::record(bounds, [&](SkCanvas *canvas) {
+            SkiaRenderer renderer(canvas);
+            inst.draw(&renderer);
+        });
+    }
+    bool changed = tiles.update(picture, inst.current_transform, get_size(), bounds);
+    // Panning only moves the tiles, so the item is redrawn even if none were rasterized
+    owner->queue_redraw();
+    return changed;
+}
+
+bool RiveViewerBase::frame(float delta, bool force) {
+    if (use_flipbook()) {
+        if (!flipbook) {
+            flipbook = FlipbookCache::get_singleton().acquire(
+                props.path(),
+                props.artboard(),
+                props.animation(),
+                width(),
+                height(),
+                props.fit(),
+                props.alignment(),
+                props.flipbook_fps()
+            );
+            // Fall back to live rendering for animations that can't be baked (e.g. too many frames for one atlas)
+            flipbook_failed = !flipbook;
+        }
+        if (flipbook) return advance_flipbook(delta, force);
     }
 
-    if (!exists(inst.file) || !exists(inst.artboard()) || !sk.renderer || !sk.surface) {
-        return PackedByteArray();
+    if (use_sync_group()) {
+        if (!sync) {
+            sync = SyncGroups::get_singleton().join(
+                props.path(), props.artboard(), props.animation(), width(), height(), props.fit(), props.alignment()
+            );
+            sync_failed = !sync;
+        }
+        if (sync) {
+            elapsed += delta;
+            bool changed = sync->tick(delta);
+            if (changed || force) owner->queue_redraw();
+            return changed;
+        }
     }
 
+    // With the artboard set to None, composed artboards still play on their own
+    if (!exists(inst.file) || (!exists(inst.artboard()) && inst.composer.empty())) return false;
+    if (!use_canvas() && (!sk.renderer || !sk.surface)) return false;
+
     elapsed += delta;
-    bool changed = inst.advance(delta);
-    if (!changed) {
-        return PackedByteArray();
+    bool changed;
+    {
+        ScopedTimer timer(RiveStats::get_singleton().frame().advance_nsec, &render_stats.sample().advance_nsec);
+        changed = inst.advance(delta);
+    }
+    if (!changed && !force) {
+        return false;
+    }
+
+    if (use_tiles()) return redraw_tiles();
+    if (use_canvas()) {
+        redraw();
+        return true;
+    }
+    return upload(redraw());
+}
+
+bool RiveViewerBase::upload(PackedByteArray bytes) {
+    if (bytes.is_empty() || is_null(image) || is_null(texture)) {
+        return false;
+    }
+
+    // Ensure image size matches expected size
+    int expected_size = width() * height() * sk.output_bytes_per_pixel();
+    if (bytes.size() != expected_size) {
+        return false;
     }
 
-    PackedByteArray bytes = redraw();
+    RIVE_TRACE(TRACE_UPLOAD, inst.trace_context);
 
-    if (bytes.size() > 0 && !is_null(image) && !is_null(texture)) {
-        // Ensure image size matches expected size
-        int expected_size = width() * height() * 4; // RGBA8 = 4 bytes per pixel
-        if (bytes.size() == expected_size) {
-            image->set_data(width(), height(), false, Image::FORMAT_RGBA8, bytes);
-            texture->set_image(image);
+    if (use_atlas()) {
+        auto &atlas = TextureAtlas::get_singleton();
+        if (!atlas_slot.is_valid()) atlas_slot = atlas.allocate(width(), height());
+        if (atlas_slot.is_valid()) {
+            // The slot's shelf is uploaded, and counted, once per frame in TextureAtlas::flush()
+            ScopedTimer timer(render_stats.sample().upload_nsec);
+            render_stats.sample().bytes += bytes.size();
+            atlas.write(atlas_slot, bytes);
             owner->queue_redraw();
+            return true;
         }
     }
 
-    return bytes;
+    auto &stats = RiveStats::get_singleton().frame();
+    ScopedTimer timer(stats.upload_nsec, &render_stats.sample().upload_nsec);
+    stats.uploaded_bytes += bytes.size();
+    render_stats.sample().bytes += bytes.size();
+    image->set_data(width(), height(), false, sk.image_format(), bytes);
+    texture->update(image);
+    owner->queue_redraw();
+    return true;
+}
+
+bool RiveViewerBase::use_flipbook() const {
+    return props.flipbook_cache() && !flipbook_failed && props.scene() == -1 && props.animation() != -1 &&
+           inst.mixer.empty() && inst.composer.empty() && !use_canvas() && !props.has_view_rect() &&
+           !props.premultiplied_alpha() && props.output_format() == OUTPUT_FORMAT::OUTPUT_RGBA8;
+}
+
+bool RiveViewerBase::advance_flipbook(float delta, bool force) {
+    elapsed += delta;
+    flipbook_time += delta;
+    int index = flipbook->frame_at(flipbook_time);
+    if (index == flipbook_frame && !force) return false;
+    flipbook_frame = index;
+    owner->queue_redraw();
+    return true;
+}
+
+void RiveViewerBase::reset_flipbook() {
+    flipbook.reset();
+    flipbook_failed = false;
+    flipbook_time = 0;
+    flipbook_frame = -1;
+}
+
+bool RiveViewerBase::use_sync_group() const {
+    // Only input-free linear animations render identically across viewers
+    return props.sync_group() && !sync_failed && props.scene() == -1 && props.animation() != -1 &&
+           inst.mixer.empty() && inst.composer.empty() && !use_canvas() && !props.has_view_rect() &&
+           !props.premultiplied_alpha() && props.output_format() == OUTPUT_FORMAT::OUTPUT_RGBA8;
+}
+
+void RiveViewerBase::reset_sync_group() {
+    sync.reset();
+    sync_failed = false;
+}
+
+bool RiveViewerBase::use_atlas() const {
+    return props.atlas() && TextureAtlas::fits(width(), height()) && !use_canvas() && !use_tiles() &&
+           props.output_format() == OUTPUT_FORMAT::OUTPUT_RGBA8;
+}
+
+void RiveViewerBase::release_atlas_slot() {
+    TextureAtlas::get_singleton().release(atlas_slot);
+}
+
+bool RiveViewerBase::use_canvas() const {
+    return props.backend() == BACKEND::CANVAS;
+}
+
+void RiveViewerBase::draw_canvas() {
+    if (!canvas) canvas = rivestd::make_unique<CanvasRenderer>();
+    canvas->begin(owner->get_canvas_item());
+    canvas->save();
+    canvas->transform(inst.current_transform);
+    inst.draw(canvas.get());
+    canvas->restore();
+    inst.composer.draw(canvas.get());
+    canvas->end();
+}
+
+void RiveViewerBase::set_backend(int value) {
+    if (value == props.backend()) return;
+    props.backend((BACKEND)value);
+    if (canvas) canvas->clear();
+    canvas.reset();
+    tiles.clear();
+    release_atlas_slot();
+    reset_flipbook();
+    reset_sync_group();
+    sk.update_surface();
+    _on_size_changed(width(), height());
+    update_blend_material();
+    // Render objects belong to the factory the file was imported with
+    reload_file();
+    owner->queue_redraw();
+}
+
+void RiveViewerBase::reload_file() {
+    const String path = props.path();
+    const int artboard = props.artboard(), scene = props.scene(), animation = props.animation();
+    if (path.is_empty()) return;
+    // Imports again in place; going through set_file_path("") would report the empty path as a failed import
+    release_pooled_file();
+    props.artboard(-1);
+    inst.on_path_changed(path);
+    _on_path_changed(path);
+
+    if (exists(inst.file) && artboard >= 0 && artboard < inst.file->get_artboard_count()) {
+        props.artboard(artboard);
+        props.scene(scene);
+        props.animation(animation);
+        inst.instantiate();
+    }
+    upload(redraw());
+}
+
+void RiveViewerBase::set_premultiplied_alpha(bool value) {
+    if (value == props.premultiplied_alpha()) return;
+    // Flipbooks and sync groups are baked with straight alpha
+    reset_flipbook();
+    reset_sync_group();
+    props.premultiplied_alpha(value);
+    update_blend_material();
+}
+
+void RiveViewerBase::set_output_format(int value) {
+    if (value == props.output_format()) return;
+    // Shared renders and the atlas only hold RGBA8
+    reset_flipbook();
+    reset_sync_group();
+    release_atlas_slot();
+    tiles.clear();
+    static_layer.clear();
+    props.output_format((OUTPUT_FORMAT)value);
+    update_blend_material();
+    upload(redraw());
+}
+
+void RiveViewerBase::update_blend_material() {
+    // Set on the canvas item directly, so it isn't saved with the node. Assigning the node a material replaces it,
+    // so the node's material is kept and the conflict reported (see on_draw())
+    user_material = owner->get_material();
+    RID material = user_material.is_valid() ? user_material->get_rid() : RID();
+    const bool mask = props.output_format() == OUTPUT_FORMAT::OUTPUT_MASK;
+    // The canvas backend draws vector paint through its own canvas items, which blend normally
+    const bool blended = !use_canvas() && (mask || props.premultiplied_alpha());
+    if (blended && user_material.is_valid()) {
+        const String mode = mask ? "The mask output" : "premultiplied_alpha";
+        const String message = mode + " blends through its own material; the node's material replaces it.";
+        RiveException(message).from(owner, "update_blend_material").warning().report();
+    } else if (blended && mask) {
+        if (mask_material.is_null()) {
+            Ref<Shader> shader;
+            shader.instantiate();
+            shader->set_code(MASK_SHADER_CODE);
+            mask_material.instantiate();
+            mask_material->set_shader(shader);
+        }
+        material = mask_material->get_rid();
+    } else if (blended) {
+        if (premultiplied_material.is_null()) {
+            premultiplied_material.instantiate();
+            premultiplied_material->set_blend_mode(CanvasItemMaterial::BLEND_MODE_PREMULT_ALPHA);
+        }
+        material = premultiplied_material->get_rid();
+    }
+    RenderingServer::get_singleton()->canvas_item_set_material(owner->get_canvas_item(), material);
+}
+
+void RiveViewerBase::update_trace_context() {
+#ifdef RIVE_TRACE_ENABLED
+    auto artboard = inst.artboard();
+    String artboard_name = exists(artboard) ? artboard->get_name() : "";
+    // Only relabels; the tracer interns the labels once an event is recorded with them
+    inst.trace_context = TraceContext(owner->get_instance_id(), props.path(), artboard_name);
+#endif
+}
+
+void RiveViewerBase::release_pooled_file() {
+    auto pool = RiveInstancePool::get_singleton();
+    // Layer instances point into the artboard the pool is about to reinstantiate
+    inst.mixer.unbind();
+    if (pool && exists(pooled_file)) pool->release(pooled_file, props.artboard());
+    unref(pooled_file);
+}
+
+void RiveViewerBase::reset_rendered_once() {
+    if (!rendered_once) return;
+    rendered_once = false;
+    update_processing();
 }
 
 float RiveViewerBase::get_elapsed_time() const {
@@ -364,6 +766,144 @@ void RiveViewerBase::go_to_animation(Ref<RiveAnimation> animation_value) {
     }
 }
 
+void RiveViewerBase::set_zoom(float zoom) {
+    auto artboard = inst.artboard();
+    if (zoom <= 0 || !exists(artboard)) return;
+    // Zoom around the middle of the current view, or of the artboard if there is no view yet
+    Rect2 view = props.has_view_rect() ? props.view_rect() : artboard->get_bounds();
+    Vector2 size = get_size() / zoom;
+    props.view_rect(Rect2(view.get_center() - size / 2, size));
+}
+
+float RiveViewerBase::get_zoom() const {
+    const rive::Mat2D &t = inst.current_transform;
+    return std::sqrt(std::abs(t.xx() * t.yy() - t.xy() * t.yx()));
+}
+
+Dictionary RiveViewerBase::get_render_stats() const {
+    Dictionary stats = render_stats.to_dictionary();
+    stats["surface_width"] = sk.surface ? sk.surface->width() : 0;
+    stats["surface_height"] = sk.surface ? sk.surface->height() : 0;
+    return stats;
+}
+
+int RiveViewerBase::add_animation_layer(int animation, float weight, float speed, int loop_mode) {
+    try {
+        auto artboard = inst.artboard();
+        if (!exists(artboard))
+            throw RiveException("Attempted to add an animation layer without an artboard")
+                .from(owner, "add_animation_layer")
+                .warning();
+        if (animation < 0 || animation >= artboard->get_animation_count())
+            throw RiveException("Animation layer index out of range").from(owner, "add_animation_layer").warning();
+    } catch (RiveException error) {
+        error.report();
+        return -1;
+    }
+    // Layered output depends on runtime layer state, so shared renders no longer apply
+    reset_flipbook();
+    reset_sync_group();
+    return inst.mixer.add(animation, weight, speed, loop_mode);
+}
+
+void RiveViewerBase::remove_animation_layer(int layer) {
+    inst.mixer.remove(layer);
+}
+
+void RiveViewerBase::clear_animation_layers() {
+    inst.mixer.clear();
+}
+
+int RiveViewerBase::get_animation_layer_count() const {
+    return inst.mixer.size();
+}
+
+void RiveViewerBase::set_animation_layer_weight(int layer, float weight) {
+    inst.mixer.set_weight(layer, weight);
+}
+
+void RiveViewerBase::set_animation_layer_speed(int layer, float speed) {
+    inst.mixer.set_speed(layer, speed);
+}
+
+void RiveViewerBase::set_animation_layer_loop_mode(int layer, int loop_mode) {
+    inst.mixer.set_loop_mode(layer, loop_mode);
+}
+
+float RiveViewerBase::get_animation_layer_time(int layer) const {
+    return inst.mixer.time(layer);
+}
+
+void RiveViewerBase::reset_animation_layer(int layer) {
+    inst.mixer.reset(layer);
+}
+
+int RiveViewerBase::add_composed_artboard(int artboard, Rect2 rect, int fit, int alignment, int order) {
+    int id = -1;
+    try {
+        if (!exists(inst.file))
+            throw RiveException("Attempted to compose an artboard without a file")
+                .from(owner, "add_composed_artboard")
+                .warning();
+        id = inst.composer.add(inst.file->file.get(), artboard, rect, (FIT)fit, (ALIGN)alignment, order);
+        if (id == -1)
+            throw RiveException("Unable to instantiate composed artboard.").from(owner, "add_composed_artboard");
+    } catch (RiveException error) {
+        error.report();
+        return -1;
+    }
+    reset_flipbook();
+    reset_sync_group();
+    upload(redraw());
+    return id;
+}
+
+void RiveViewerBase::remove_composed_artboard(int id) {
+    inst.composer.remove(id);
+    upload(redraw());
+}
+
+void RiveViewerBase::clear_composed_artboards() {
+    inst.composer.clear();
+    upload(redraw());
+}
+
+int RiveViewerBase::get_composed_artboard_count() const {
+    return inst.composer.size();
+}
+
+void RiveViewerBase::set_composed_artboard_order(int id, int order) {
+    inst.composer.set_order(id, order);
+    upload(redraw());
+}
+
+int RiveViewerBase::get_composed_artboard_order(int id) const {
+    return inst.composer.get_order(id);
+}
+
+void RiveViewerBase::set_composed_artboard_rect(int id, Rect2 rect) {
+    inst.composer.set_rect(id, rect);
+    upload(redraw());
+}
+
+void RiveViewerBase::set_composed_artboard_fit(int id, int fit) {
+    inst.composer.set_fit(id, (FIT)fit);
+    upload(redraw());
+}
+
+void RiveViewerBase::set_composed_artboard_alignment(int id, int alignment) {
+    inst.composer.set_alignment(id, (ALIGN)alignment);
+    upload(redraw());
+}
+
+void RiveViewerBase::set_composed_artboard_input(int id, String name, Variant value) {
+    inst.composer.set_input(id, name, value);
+}
+
+void RiveViewerBase::fire_composed_artboard_trigger(int id, String name) {
+    inst.composer.fire_trigger(id, name);
+}
+
 void RiveViewerBase::press_mouse(Vector2 position) {
     inst.press_mouse(position);
 }
@@ -376,6 +916,10 @@ void RiveViewerBase::move_mouse(Vector2 position) {
     inst.move_mouse(position);
 }
 
+void RiveViewerBase::render_now(float delta) {
+    render_stats.end_frame(frame(delta, true));
+}
+
 Vector2 RiveViewerBase::local_to_rive(Vector2 local) const {
     // 使用与渲染完全一致的变换矩阵（inst.current_transform）的逆矩阵来换算，避免偏移
     auto ab = inst.artboard();
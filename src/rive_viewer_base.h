@@ -2,10 +2,12 @@
 #define RIVEEXTENSION_VIEWER_BASE_H
 
 // stdlib
+#include <memory>
 #include <vector>
 
 // godot-cpp
 #include <godot_cpp/classes/canvas_item.hpp>
+#include <godot_cpp/classes/canvas_item_material.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/image.hpp>
 #include <godot_cpp/classes/image_texture.hpp>
@@ -13,7 +15,9 @@
 #include <godot_cpp/classes/input_event_mouse.hpp>
 #include <godot_cpp/classes/input_event_mouse_button.hpp>
 #include <godot_cpp/classes/input_event_mouse_motion.hpp>
+#include <godot_cpp/classes/material.hpp>
 #include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/classes/shader_material.hpp>
 #include <godot_cpp/core/binder_common.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/builtin_types.hpp>
@@ -32,8 +36,15 @@
 
 // extension
 #include "api/rive_file.hpp"
+#include "canvas_renderer.h"
+#include "flipbook_cache.hpp"
+#include "render_stats.hpp"
 #include "rive_instance.hpp"
 #include "skia_instance.hpp"
+#include "static_layer.hpp"
+#include "sync_group.hpp"
+#include "texture_atlas.hpp"
+#include "tile_cache.hpp"
 #include "utils/out_redirect.hpp"
 #include "utils/types.hpp"
 #include "viewer_props.hpp"
@@ -51,9 +62,27 @@ class RiveViewerBase {
     RiveInstance inst;
     SkiaInstance sk;
     float elapsed = 0;
+    // Set once an UPDATE_ONCE viewer has drawn a frame; cleared when the mode, file or artboard changes
+    bool rendered_once = false;
     Dictionary cached_scene_property_values;
     Ref<Image> image;
     Ref<ImageTexture> texture;
+    std::shared_ptr<Flipbook> flipbook;
+    bool flipbook_failed = false;
+    float flipbook_time = 0;
+    int flipbook_frame = -1;
+    std::shared_ptr<SyncGroup> sync;
+    bool sync_failed = false;
+    AtlasSlot atlas_slot;
+    Ref<RiveFile> pooled_file;
+    Ptr<CanvasRenderer> canvas;
+    TileCache tiles;
+    StaticLayer static_layer;
+    Ref<CanvasItemMaterial> premultiplied_material;
+    Ref<ShaderMaterial> mask_material;
+    // The node's material when the blend material was last chosen
+    Ref<Material> user_material;
+    RenderStats render_stats;
 
    protected:
     void _on_path_changed(String path);
@@ -63,12 +92,36 @@ class RiveViewerBase {
     void _on_size_changed(float w, float h);
     void _on_transform_changed();
     void check_scene_property_changed();
+    void update_processing();
+    void reset_rendered_once();
     bool advance(float delta);
-    PackedByteArray frame(float delta);
+    bool frame(float delta, bool force = false);
+    bool upload(PackedByteArray bytes);
+    bool use_flipbook() const;
+    bool advance_flipbook(float delta, bool force);
+    void reset_flipbook();
+    bool use_sync_group() const;
+    void reset_sync_group();
+    bool use_atlas() const;
+    void release_atlas_slot();
+    void release_pooled_file();
+    bool use_canvas() const;
+    bool covers_surface() const;
+    void draw_canvas();
+    void reload_file();
+    void update_blend_material();
+    void update_trace_context();
     PackedByteArray redraw();
+    bool raster();
+    bool raster_tiled();
+    void raster_static();
+    sk_sp<SkPicture> record_frame();
+    bool use_tiles() const;
+    bool redraw_tiles();
 
    public:
     RiveViewerBase(CanvasItem *owner);
+    ~RiveViewerBase();
 
     void on_ready();
     void on_draw();
@@ -81,9 +134,24 @@ class RiveViewerBase {
     int width() const;
     int height() const;
 
+    CanvasItem *get_owner() const {
+        return owner;
+    }
+
+    /* Average cost of a rendered frame over the stats window, in milliseconds. */
+    double get_render_cost_ms() const {
+        return render_stats.get_cost_ms();
+    }
+
+    const RenderStats::Sample &get_last_render_sample() const {
+        return render_stats.get_last();
+    }
+
     /* Setters */
 
     void set_file_path(String value) {
+        // Must happen while the old artboard is still selected
+        if (value != props.path()) release_pooled_file();
         props.path(value);
     }
 
@@ -115,6 +183,55 @@ class RiveViewerBase {
         props.size(value.x, value.y);
     }
 
+    void set_update_mode(int value) {
+        props.update_mode((UPDATE_MODE)value);
+        rendered_once = false;
+        update_processing();
+    }
+
+    void set_flipbook_cache(bool value) {
+        props.flipbook_cache(value);
+        reset_flipbook();
+    }
+
+    void set_flipbook_fps(float value) {
+        props.flipbook_fps(value);
+        reset_flipbook();
+    }
+
+    void set_sync_group(bool value) {
+        props.sync_group(value);
+        reset_sync_group();
+    }
+
+    void set_atlas(bool value) {
+        props.atlas(value);
+        release_atlas_slot();
+        upload(redraw());
+    }
+
+    void set_use_pool(bool value) {
+        if (value == props.use_pool()) return;
+        props.use_pool(value);
+        // Moves an already loaded file into or out of the pool
+        reload_file();
+    }
+
+    void set_backend(int value);
+
+    void set_static_layer_cache(bool value) {
+        props.static_layer_cache(value);
+        static_layer.clear();
+    }
+
+    void set_premultiplied_alpha(bool value);
+
+    void set_output_format(int value);
+
+    void set_view_rect(Rect2 value) {
+        props.view_rect(value);
+    }
+
     /* Getters */
 
     String get_file_path() const {
@@ -149,6 +266,50 @@ class RiveViewerBase {
         return props.size();
     }
 
+    int get_update_mode() const {
+        return props.update_mode();
+    }
+
+    bool get_flipbook_cache() const {
+        return props.flipbook_cache();
+    }
+
+    float get_flipbook_fps() const {
+        return props.flipbook_fps();
+    }
+
+    bool get_sync_group() const {
+        return props.sync_group();
+    }
+
+    bool get_atlas() const {
+        return props.atlas();
+    }
+
+    bool get_use_pool() const {
+        return props.use_pool();
+    }
+
+    int get_backend() const {
+        return props.backend();
+    }
+
+    bool get_static_layer_cache() const {
+        return props.static_layer_cache();
+    }
+
+    bool get_premultiplied_alpha() const {
+        return props.premultiplied_alpha();
+    }
+
+    int get_output_format() const {
+        return props.output_format();
+    }
+
+    Rect2 get_view_rect() const {
+        return props.view_rect();
+    }
+
     /* Signals */
 
     void pressed(Vector2 position) const {}
@@ -169,10 +330,42 @@ class RiveViewerBase {
     void go_to_scene(Ref<RiveScene> scene);
     void go_to_animation(Ref<RiveAnimation> animation);
 
+    void set_zoom(float zoom);
+    float get_zoom() const;
+
+    Dictionary get_render_stats() const;
+
+    // Returns a layer id for the other layer methods; ids stay valid when other layers are removed
+    int add_animation_layer(int animation, float weight = 1, float speed = 1, int loop_mode = -1);
+    void remove_animation_layer(int layer);
+    void clear_animation_layers();
+    int get_animation_layer_count() const;
+    void set_animation_layer_weight(int layer, float weight);
+    void set_animation_layer_speed(int layer, float speed);
+    void set_animation_layer_loop_mode(int layer, int loop_mode);
+    float get_animation_layer_time(int layer) const;
+    void reset_animation_layer(int layer);
+
+    int add_composed_artboard(
+        int artboard, Rect2 rect, int fit = FIT::CONTAIN, int alignment = ALIGN::CENTER, int order = 0
+    );
+    void remove_composed_artboard(int id);
+    void clear_composed_artboards();
+    int get_composed_artboard_count() const;
+    void set_composed_artboard_order(int id, int order);
+    int get_composed_artboard_order(int id) const;
+    void set_composed_artboard_rect(int id, Rect2 rect);
+    void set_composed_artboard_fit(int id, int fit);
+    void set_composed_artboard_alignment(int id, int alignment);
+    void set_composed_artboard_input(int id, String name, Variant value);
+    void fire_composed_artboard_trigger(int id, String name);
+
     void press_mouse(Vector2 position);
     void release_mouse(Vector2 position);
     void move_mouse(Vector2 position);
 
+    void render_now(float delta);
+
     // Convenience utilities
     Vector2 local_to_rive(Vector2 local) const;
     bool set_node_position_from_local(String node_name, Vector2 local);
@@ -194,6 +387,9 @@ class RiveViewerBase {
     RIVE_VIEWER_SET(type, prop_name)
 
 #define RIVE_VIEWER_BIND(cls)                                                                    \
+    /* Bound first so scenes set them before file_path and import only once */                 \
+    ADD_PROP_WITH_HINT(cls, Variant::INT, backend, PROPERTY_HINT_ENUM, BackendEnumPropertyHint); \
+    ADD_PROP(cls, Variant::BOOL, use_pool);                                                      \
     ADD_PROP_WITH_HINT(cls, Variant::STRING, file_path, PROPERTY_HINT_FILE, "*.riv");            \
     ADD_PROP_WITH_HINT(cls, Variant::INT, fit, PROPERTY_HINT_ENUM, FitEnumPropertyHint);         \
     ADD_PROP_WITH_HINT(cls, Variant::INT, alignment, PROPERTY_HINT_ENUM, AlignEnumPropertyHint); \
@@ -201,6 +397,15 @@ class RiveViewerBase {
     ADD_PROP(cls, Variant::BOOL, disable_hover);                                                 \
     ADD_PROP(cls, Variant::BOOL, paused);                                                        \
     ADD_PROP(cls, Variant::BOOL, use_global_input);                                              \
+    ADD_PROP_WITH_HINT(cls, Variant::INT, update_mode, PROPERTY_HINT_ENUM, UpdateModeEnumPropertyHint); \
+    ADD_PROP(cls, Variant::BOOL, flipbook_cache);                                                \
+    ADD_PROP_WITH_HINT(cls, Variant::FLOAT, flipbook_fps, PROPERTY_HINT_RANGE, "1,120,1");       \
+    ADD_PROP(cls, Variant::BOOL, sync_group);                                                    \
+    ADD_PROP(cls, Variant::BOOL, atlas);                                                         \
+    ADD_PROP(cls, Variant::BOOL, static_layer_cache);                                            \
+    ADD_PROP(cls, Variant::BOOL, premultiplied_alpha);                                           \
+    ADD_PROP_WITH_HINT(cls, Variant::INT, output_format, PROPERTY_HINT_ENUM, OutputFormatEnumPropertyHint); \
+    ADD_PROP(cls, Variant::RECT2, view_rect);                                                    \
     ADD_SIGNAL(MethodInfo("pressed", PropertyInfo(Variant::VECTOR2, "position")));               \
     ADD_SIGNAL(MethodInfo("released", PropertyInfo(Variant::VECTOR2, "position")));              \
     ADD_SIGNAL(MethodInfo(                                                                       \
@@ -218,9 +423,65 @@ class RiveViewerBase {
     ClassDB::bind_method(D_METHOD("go_to_artboard", "artboard"), &cls::go_to_artboard);          \
     ClassDB::bind_method(D_METHOD("go_to_scene", "scene"), &cls::go_to_scene);                   \
     ClassDB::bind_method(D_METHOD("go_to_animation", "animation"), &cls::go_to_animation);       \
+    ClassDB::bind_method(D_METHOD("set_zoom", "zoom"), &cls::set_zoom);                          \
+    ClassDB::bind_method(D_METHOD("get_zoom"), &cls::get_zoom);                                  \
+    ClassDB::bind_method(D_METHOD("get_render_stats"), &cls::get_render_stats);                  \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("add_animation_layer", "animation", "weight", "speed", "loop_mode"),            \
+        &cls::add_animation_layer,                                                               \
+        DEFVAL(1.0),                                                                             \
+        DEFVAL(1.0),                                                                             \
+        DEFVAL(-1)                                                                               \
+    );                                                                                           \
+    ClassDB::bind_method(D_METHOD("remove_animation_layer", "layer"), &cls::remove_animation_layer); \
+    ClassDB::bind_method(D_METHOD("clear_animation_layers"), &cls::clear_animation_layers);      \
+    ClassDB::bind_method(D_METHOD("get_animation_layer_count"), &cls::get_animation_layer_count); \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_animation_layer_weight", "layer", "weight"), &cls::set_animation_layer_weight \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_animation_layer_speed", "layer", "speed"), &cls::set_animation_layer_speed \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_animation_layer_loop_mode", "layer", "loop_mode"), &cls::set_animation_layer_loop_mode \
+    );                                                                                           \
+    ClassDB::bind_method(D_METHOD("get_animation_layer_time", "layer"), &cls::get_animation_layer_time); \
+    ClassDB::bind_method(D_METHOD("reset_animation_layer", "layer"), &cls::reset_animation_layer); \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("add_composed_artboard", "artboard", "rect", "fit", "alignment", "order"),      \
+        &cls::add_composed_artboard,                                                             \
+        DEFVAL(FIT::CONTAIN),                                                                    \
+        DEFVAL(ALIGN::CENTER),                                                                   \
+        DEFVAL(0)                                                                                \
+    );                                                                                           \
+    ClassDB::bind_method(D_METHOD("remove_composed_artboard", "id"), &cls::remove_composed_artboard); \
+    ClassDB::bind_method(D_METHOD("clear_composed_artboards"), &cls::clear_composed_artboards);  \
+    ClassDB::bind_method(D_METHOD("get_composed_artboard_count"), &cls::get_composed_artboard_count); \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_composed_artboard_order", "id", "order"), &cls::set_composed_artboard_order \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("get_composed_artboard_order", "id"), &cls::get_composed_artboard_order         \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_composed_artboard_rect", "id", "rect"), &cls::set_composed_artboard_rect   \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_composed_artboard_fit", "id", "fit"), &cls::set_composed_artboard_fit      \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_composed_artboard_alignment", "id", "alignment"), &cls::set_composed_artboard_alignment \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("set_composed_artboard_input", "id", "name", "value"), &cls::set_composed_artboard_input \
+    );                                                                                           \
+    ClassDB::bind_method(                                                                        \
+        D_METHOD("fire_composed_artboard_trigger", "id", "name"), &cls::fire_composed_artboard_trigger \
+    );                                                                                           \
     ClassDB::bind_method(D_METHOD("press_mouse", "position"), &cls::press_mouse);                \
     ClassDB::bind_method(D_METHOD("release_mouse", "position"), &cls::release_mouse);            \
     ClassDB::bind_method(D_METHOD("move_mouse", "position"), &cls::move_mouse);                 \
+    ClassDB::bind_method(D_METHOD("render_now", "delta"), &cls::render_now);                     \
     ClassDB::bind_method(D_METHOD("local_to_rive", "local"), &cls::local_to_rive);               \
     ClassDB::bind_method(D_METHOD("set_node_position_from_local", "name", "local"),              \
         &cls::set_node_position_from_local);                                                        \
@@ -262,6 +523,17 @@ class RiveViewerBase {
     RIVE_VIEWER_SETGET(bool, disable_hover)                                  \
     RIVE_VIEWER_SETGET(bool, paused)                                         \
     RIVE_VIEWER_SETGET(bool, use_global_input)                                \
+    RIVE_VIEWER_SETGET(int, update_mode)                                     \
+    RIVE_VIEWER_SETGET(bool, flipbook_cache)                                 \
+    RIVE_VIEWER_SETGET(float, flipbook_fps)                                  \
+    RIVE_VIEWER_SETGET(bool, sync_group)                                     \
+    RIVE_VIEWER_SETGET(bool, atlas)                                          \
+    RIVE_VIEWER_SETGET(bool, use_pool)                                       \
+    RIVE_VIEWER_SETGET(int, backend)                                         \
+    RIVE_VIEWER_SETGET(bool, static_layer_cache)                             \
+    RIVE_VIEWER_SETGET(bool, premultiplied_alpha)                            \
+    RIVE_VIEWER_SETGET(int, output_format)                                   \
+    RIVE_VIEWER_SETGET(Rect2, view_rect)                                     \
     RIVE_VIEWER_GET(float, elapsed_time)                                     \
     RIVE_VIEWER_GET(Ref<RiveFile>, file)                                     \
     RIVE_VIEWER_GET(Ref<RiveArtboard>, artboard)                             \
@@ -276,6 +548,78 @@ class RiveViewerBase {
     void go_to_animation(Ref<RiveAnimation> animation) {                     \
         base.go_to_animation(animation);                                     \
     }                                                                        \
+    void set_zoom(float zoom) {                                              \
+        base.set_zoom(zoom);                                                 \
+    }                                                                        \
+    float get_zoom() const {                                                 \
+        return base.get_zoom();                                              \
+    }                                                                        \
+    Dictionary get_render_stats() const {                                    \
+        return base.get_render_stats();                                      \
+    }                                                                        \
+    void render_now(float delta) {                                           \
+        base.render_now(delta);                                              \
+    }                                                                        \
+    int add_animation_layer(int animation, float weight, float speed, int loop_mode) { \
+        return base.add_animation_layer(animation, weight, speed, loop_mode); \
+    }                                                                        \
+    void remove_animation_layer(int layer) {                                 \
+        base.remove_animation_layer(layer);                                  \
+    }                                                                        \
+    void clear_animation_layers() {                                          \
+        base.clear_animation_layers();                                       \
+    }                                                                        \
+    int get_animation_layer_count() const {                                  \
+        return base.get_animation_layer_count();                             \
+    }                                                                        \
+    void set_animation_layer_weight(int layer, float weight) {               \
+        base.set_animation_layer_weight(layer, weight);                      \
+    }                                                                        \
+    void set_animation_layer_speed(int layer, float speed) {                 \
+        base.set_animation_layer_speed(layer, speed);                        \
+    }                                                                        \
+    void set_animation_layer_loop_mode(int layer, int loop_mode) {           \
+        base.set_animation_layer_loop_mode(layer, loop_mode);                \
+    }                                                                        \
+    float get_animation_layer_time(int layer) const {                        \
+        return base.get_animation_layer_time(layer);                         \
+    }                                                                        \
+    void reset_animation_layer(int layer) {                                  \
+        base.reset_animation_layer(layer);                                   \
+    }                                                                        \
+    int add_composed_artboard(int artboard, Rect2 rect, int fit, int alignment, int order) { \
+        return base.add_composed_artboard(artboard, rect, fit, alignment, order); \
+    }                                                                        \
+    void remove_composed_artboard(int id) {                                  \
+        base.remove_composed_artboard(id);                                   \
+    }                                                                        \
+    void clear_composed_artboards() {                                        \
+        base.clear_composed_artboards();                                     \
+    }                                                                        \
+    int get_composed_artboard_count() const {                                \
+        return base.get_composed_artboard_count();                           \
+    }                                                                        \
+    void set_composed_artboard_order(int id, int order) {                    \
+        base.set_composed_artboard_order(id, order);                         \
+    }                                                                        \
+    int get_composed_artboard_order(int id) const {                          \
+        return base.get_composed_artboard_order(id);                         \
+    }                                                                        \
+    void set_composed_artboard_rect(int id, Rect2 rect) {                    \
+        base.set_composed_artboard_rect(id, rect);                           \
+    }                                                                        \
+    void set_composed_artboard_fit(int id, int fit) {                        \
+        base.set_composed_artboard_fit(id, fit);                             \
+    }                                                                        \
+    void set_composed_artboard_alignment(int id, int alignment) {            \
+        base.set_composed_artboard_alignment(id, alignment);                 \
+    }                                                                        \
+    void set_composed_artboard_input(int id, String name, Variant value) {   \
+        base.set_composed_artboard_input(id, name, value);                   \
+    }                                                                        \
+    void fire_composed_artboard_trigger(int id, String name) {               \
+        base.fire_composed_artboard_trigger(id, name);                       \
+    }                                                                        \
     void press_mouse(Vector2 position) {                                     \
         base.press_mouse(position);                                          \
     }                                                                        \
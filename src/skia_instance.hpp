@@ -7,6 +7,7 @@
 #include <cstring>
 
 // godot-cpp
+#include <godot_cpp/classes/image.hpp>
 #include <godot_cpp/variant/builtin_types.hpp>
 
 // skia
@@ -18,6 +19,8 @@
 #include <skia/renderer/include/skia_renderer.hpp>
 
 // extension
+#include "rive_stats.hpp"
+#include "utils/pixel_kernels.hpp"
 #include "utils/types.hpp"
 #include "viewer_props.hpp"
 
@@ -33,56 +36,89 @@ struct SkiaInstance {
     void set_props(ViewerProps *props_value) {
         props = props_value;
         if (props) {
-            props->on_transform_changed([this]() { on_transform_changed(); });
+            props->on_transform_changed([this]() { update_surface(); });
         }
     }
 
     SkImageInfo image_info() const {
-        return SkImageInfo::Make(
-            props ? props->width() : 1,
-            props ? props->height() : 1,
-            SkColorType::kRGBA_8888_SkColorType,
-            SkAlphaType::kUnpremul_SkAlphaType
-        );
+        const int w = props ? props->width() : 1;
+        const int h = props ? props->height() : 1;
+        const OUTPUT_FORMAT format = props ? props->output_format() : OUTPUT_FORMAT::OUTPUT_RGBA8;
+        if (format == OUTPUT_FORMAT::OUTPUT_MASK) return SkImageInfo::MakeA8(w, h);
+        if (format == OUTPUT_FORMAT::OUTPUT_RGB8)
+            return SkImageInfo::Make(w, h, SkColorType::kRGBA_8888_SkColorType, SkAlphaType::kOpaque_SkAlphaType);
+        // Always premultiplied: an unpremul surface makes Skia convert on every blend. Straight alpha is produced once,
+        // when reading back (see bytes())
+        return SkImageInfo::Make(w, h, SkColorType::kRGBA_8888_SkColorType, SkAlphaType::kPremul_SkAlphaType);
+    }
+
+    Image::Format image_format() const {
+        switch (props ? props->output_format() : OUTPUT_FORMAT::OUTPUT_RGBA8) {
+            case OUTPUT_FORMAT::OUTPUT_RGB8:
+                return Image::FORMAT_RGB8;
+            case OUTPUT_FORMAT::OUTPUT_MASK:
+                return Image::FORMAT_R8;
+            case OUTPUT_FORMAT::OUTPUT_RGBA8:
+            default:
+                return Image::FORMAT_RGBA8;
+        }
+    }
+
+    /* Bytes per pixel of what bytes() returns, which for RGB8 is less than the surface's. */
+    int output_bytes_per_pixel() const {
+        return Image::get_format_pixel_size(image_format());
     }
 
     PackedByteArray bytes() const {
         PackedByteArray out;
         if (!surface) return out;
+        ScopedTimer timer(RiveStats::get_singleton().frame().copy_nsec);
         SkPixmap pm;
         if (!surface->peekPixels(&pm)) return out;
         const auto info = pm.info();
         const int w = info.width();
         const int h = info.height();
-        const size_t bpp = info.bytesPerPixel();
-        const size_t tight_row = (size_t)w * bpp;
-        out.resize(tight_row * h);
+        const size_t out_row = (size_t)w * output_bytes_per_pixel();
+        out.resize(out_row * h);
         uint8_t *dst = out.ptrw();
         const uint8_t *src = static_cast<const uint8_t *>(pm.addr());
-        if (pm.rowBytes() == tight_row) {
-            // 连续内存，整块复制
-            if (src && dst && tight_row * h) {
-                memcpy(dst, src, tight_row * h);
-            }
-        } else {
-            // 非紧凑行距，逐行复制到紧凑缓冲
-            for (int y = 0; y < h; ++y) {
-                const uint8_t *row_src = static_cast<const uint8_t *>(pm.addr(0, y));
-                uint8_t *row_dst = dst + (size_t)y * tight_row;
-                if (row_src) memcpy(row_dst, row_src, tight_row);
-            }
+        if (!dst || !src) return out;
+
+        switch (props ? props->output_format() : OUTPUT_FORMAT::OUTPUT_RGBA8) {
+            case OUTPUT_FORMAT::OUTPUT_RGB8:
+                for (int y = 0; y < h; ++y) pixel_kernels::rgba_to_rgb(dst + y * out_row, pm.addr8(0, y), w);
+                break;
+            case OUTPUT_FORMAT::OUTPUT_MASK:
+                pixel_kernels::copy_rect(dst, out_row, src, pm.rowBytes(), out_row, h);
+                break;
+            case OUTPUT_FORMAT::OUTPUT_RGBA8:
+            default:
+                if (props && props->premultiplied_alpha())
+                    pixel_kernels::copy_rect(dst, out_row, src, pm.rowBytes(), out_row, h);
+                else
+                    for (int y = 0; y < h; ++y) pixel_kernels::unpremultiply(dst + y * out_row, pm.addr8(0, y), w);
+                break;
         }
         return out;
     }
 
-    void clear() {
+    /* Clears before a frame. Opaque output drawn over the whole surface overwrites every pixel, so it's skipped. */
+    void clear(bool covered = false) {
+        if (covered && props && props->output_format() == OUTPUT_FORMAT::OUTPUT_RGB8) return;
         if (surface && renderer) surface->getCanvas()->clear(SkColors::kTransparent);
     }
 
-   private:
-    void on_transform_changed() {
+    /* (Re)creates the surface to match the props; the canvas backend draws without one. */
+    void update_surface() {
+        if (props && props->backend() == BACKEND::CANVAS) {
+            renderer.reset();
+            surface.reset();
+            return;
+        }
         auto info = image_info();
-        bool need_recreate = !surface || surface->width() != info.width() || surface->height() != info.height();
+        bool need_recreate = !surface || surface->width() != info.width() || surface->height() != info.height()
+            || surface->imageInfo().alphaType() != info.alphaType()
+            || surface->imageInfo().colorType() != info.colorType();
         if (need_recreate) {
             surface = SkSurfaces::Raster(info);
             if (!surface) {
@@ -90,12 +126,16 @@ struct SkiaInstance {
                 renderer.reset();
                 return;
             }
+            surface->getCanvas()->clear(SkColors::kTransparent);
             renderer = rivestd::make_unique<SkiaRenderer>(surface->getCanvas());
             if (!renderer) {
                 printf("[RiveViewer] ERROR: Failed to create SkiaRenderer\n");
             } else {
                 printf("[RiveViewer] SUCCESS: Created renderer with surface %dx%d\n", info.width(), info.height());
             }
+        } else {
+            // Art moved or scaled may no longer cover what it drew before
+            surface->getCanvas()->clear(SkColors::kTransparent);
         }
     }
 };
@@ -0,0 +1,99 @@
+#ifndef _RIVEEXTENSION_STATIC_LAYER_HPP_
+#define _RIVEEXTENSION_STATIC_LAYER_HPP_
+
+// stdlib
+#include <vector>
+
+// skia
+#include <skia/dependencies/skia/include/core/SkCanvas.h>
+#include <skia/dependencies/skia/include/core/SkImage.h>
+#include <skia/dependencies/skia/include/core/SkPicture.h>
+#include <skia/dependencies/skia/include/core/SkSurface.h>
+
+// extension
+#include "utils/draw_fingerprint.hpp"
+
+// Frames a draw must stay unchanged for before it is baked into the layer
+static const int STATIC_LAYER_MIN_FRAMES = 8;
+// Baking fewer draws than this isn't worth the extra surface
+static const int STATIC_LAYER_MIN_OPS = 4;
+
+/**
+ * Caches the leading draws of a frame that have stopped changing (typically the background) in an image, so each frame
+ * only rasterizes the draws after them. Only a prefix can be cached: a static draw above a live one has to be drawn
+ * after it. Draws are compared by DrawFingerprint, so a change to any cached draw's path, paint, matrix or clip shrinks
+ * the prefix on the very frame it happens.
+ */
+class StaticLayer {
+   private:
+    std::vector<uint64_t> hashes;
+    std::vector<int> stable_frames;
+    sk_sp<SkSurface> surface;
+    sk_sp<SkImage> image;
+    int cached = 0;
+
+    int stable_prefix(const std::vector<DrawFingerprint::Op> &ops) {
+        hashes.resize(ops.size(), 0);
+        stable_frames.resize(ops.size(), 0);
+        int prefix = -1;
+        for (size_t i = 0; i < ops.size(); i++) {
+            stable_frames[i] = hashes[i] == ops[i].hash ? stable_frames[i] + 1 : 0;
+            hashes[i] = ops[i].hash;
+            if (prefix == -1 && stable_frames[i] < STATIC_LAYER_MIN_FRAMES) prefix = i;
+        }
+        return prefix == -1 ? ops.size() : prefix;
+    }
+
+    void bake(SkSurface *target, const sk_sp<SkPicture> &picture, int count) {
+        image.reset();
+        cached = 0;
+        if (count < STATIC_LAYER_MIN_OPS) return;
+        if (!surface || surface->width() != target->width() || surface->height() != target->height())
+            surface = target->makeSurface(target->imageInfo());
+        if (!surface) return;
+
+        SkCanvas *canvas = surface->getCanvas();
+        canvas->resetMatrix();
+        canvas->clear(SkColors::kTransparent);
+        DrawRangeCanvas range(surface->width(), surface->height(), 0, count);
+        range.addCanvas(canvas);
+        picture->playback(&range);
+        image = surface->makeImageSnapshot();
+        if (image) cached = count;
+    }
+
+   public:
+    /* Clears the target and draws the picture into it, baking or reusing the static prefix along the way. */
+    void draw(SkSurface *target, const sk_sp<SkPicture> &picture) {
+        if (!target || !picture) return;
+        const int w = target->width(), h = target->height();
+
+        DrawFingerprint fingerprint(SkIRect::MakeWH(w, h));
+        picture->playback(&fingerprint);
+        int prefix = stable_prefix(fingerprint.ops);
+        if (prefix != cached || (image && (image->width() != w || image->height() != h)))
+            bake(target, picture, prefix);
+
+        SkCanvas *canvas = target->getCanvas();
+        canvas->resetMatrix();
+        canvas->clear(SkColors::kTransparent);
+        if (image) canvas->drawImage(image, 0, 0);
+        DrawRangeCanvas live(w, h, cached);
+        live.addCanvas(canvas);
+        picture->playback(&live);
+    }
+
+    int get_cached_ops() const {
+        return cached;
+    }
+
+    void clear() {
+        hashes.clear();
+        stable_frames.clear();
+        surface.reset();
+        image.reset();
+        cached = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef _RIVEEXTENSION_SYNC_GROUP_HPP_
+#define _RIVEEXTENSION_SYNC_GROUP_HPP_
+
+// stdlib
+#include <map>
+#include <memory>
+
+// godot-cpp
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "offscreen_instance.hpp"
+#include "rive_stats.hpp"
+#include "utils/memory.hpp"
+
+using namespace godot;
+
+/**
+ * Viewers showing the same (file, artboard, animation, size) with no inputs share one of these. The group advances
+ * and rasterizes at most once per process frame, and every member draws the same texture.
+ */
+struct SyncGroup {
+    OffscreenInstance offscreen;
+    Ref<Image> image;
+    Ref<ImageTexture> texture;
+    uint64_t last_frame = UINT64_MAX;
+    bool changed = false;
+
+    /* Returns true if the shared texture changed during the current process frame. */
+    bool tick(float delta) {
+        uint64_t frame = Engine::get_singleton()->get_process_frames();
+        if (frame == last_frame) return changed;
+        last_frame = frame;
+        changed = offscreen.advance(delta) || is_null(texture);
+        if (changed) changed = upload(offscreen.render());
+        return changed;
+    }
+
+   private:
+    bool upload(PackedByteArray bytes) {
+        const int w = offscreen.width(), h = offscreen.height();
+        if (bytes.size() != w * h * 4) return false;
+        auto &stats = RiveStats::get_singleton().frame();
+        ScopedTimer timer(stats.upload_nsec);
+        stats.uploaded_bytes += bytes.size();
+        if (is_null(image)) {
+            image = Image::create_from_data(w, h, false, Image::FORMAT_RGBA8, bytes);
+            texture = ImageTexture::create_from_image(image);
+        } else {
+            image->set_data(w, h, false, Image::FORMAT_RGBA8, bytes);
+            texture->update(image);
+        }
+        return true;
+    }
+};
+
+class SyncGroups {
+   private:
+    std::map<String, std::weak_ptr<SyncGroup>> groups;
+
+   public:
+    static SyncGroups &get_singleton() {
+        static SyncGroups singleton;
+        return singleton;
+    }
+
+    /* Returns the live group for the key, creating it if needed. Groups die with their last member. */
+    std::shared_ptr<SyncGroup> join(
+        String path, int artboard, int animation, int width, int height, FIT fit, ALIGN alignment
+    ) {
+        for (auto it = groups.begin(); it != groups.end();) {
+            if (it->second.expired()) it = groups.erase(it);
+            else it++;
+        }
+
+        String key = render_key(path, artboard, animation, width, height, fit, alignment);
+        auto found = groups.find(key);
+        if (found != groups.end()) return found->second.lock();
+
+        auto group = std::make_shared<SyncGroup>();
+        if (!group->offscreen.load(path, artboard, -1, animation, width, height, fit, alignment)) return nullptr;
+        groups[key] = group;
+        return group;
+    }
+
+    int get_count() const {
+        int count = 0;
+        for (auto const &[key, group] : groups)
+            if (!group.expired()) count++;
+        return count;
+    }
+};
+
+#endif
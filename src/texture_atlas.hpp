@@ -0,0 +1,212 @@
+#ifndef _RIVEEXTENSION_TEXTURE_ATLAS_HPP_
+#define _RIVEEXTENSION_TEXTURE_ATLAS_HPP_
+
+// stdlib
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// extension
+#include "rive_stats.hpp"
+#include "utils/memory.hpp"
+#include "utils/pixel_kernels.hpp"
+#include "utils/types.hpp"
+
+using namespace godot;
+
+static const int ATLAS_PAGE_SIZE = 1024;
+static const int ATLAS_MAX_SLOT_SIZE = 256;
+static const int ATLAS_PADDING = 1;
+
+struct AtlasSlot {
+    int page = -1;
+    int shelf = -1;
+    // In the shelf's texture
+    Rect2i rect;
+
+    bool is_valid() const {
+        return page != -1;
+    }
+};
+
+/**
+ * One row of slots, with its own texture. Godot only uploads whole textures, so the page is split by shelf and a frame
+ * uploads just the shelves that were written to, rather than the whole page.
+ */
+struct AtlasShelf {
+    int height = 0;
+    int x = 0;
+    PackedByteArray pixels;
+    Ref<Image> image;
+    Ref<ImageTexture> texture;
+    bool dirty = false;
+
+    explicit AtlasShelf(int height_value) : height(height_value) {
+        pixels.resize((size_t)ATLAS_PAGE_SIZE * height * 4);
+        memset(pixels.ptrw(), 0, pixels.size());
+        image = Image::create_from_data(ATLAS_PAGE_SIZE, height, false, Image::FORMAT_RGBA8, pixels);
+        texture = ImageTexture::create_from_image(image);
+    }
+
+    /* Zeroes a rect, so a new slot starts without the previous owner's pixels in it or its gutter. */
+    void clear(Rect2i rect) {
+        rect = rect.intersection(Rect2i(0, 0, ATLAS_PAGE_SIZE, height));
+        const size_t row = (size_t)ATLAS_PAGE_SIZE * 4;
+        for (int y = rect.position.y; y < rect.get_end().y; y++)
+            memset(pixels.ptrw() + y * row + (size_t)rect.position.x * 4, 0, (size_t)rect.size.x * 4);
+        dirty = true;
+    }
+
+    void write(Rect2i rect, const PackedByteArray &bytes) {
+        const size_t src_row = (size_t)rect.size.x * 4;
+        const size_t dst_row = (size_t)ATLAS_PAGE_SIZE * 4;
+        if (bytes.size() != src_row * rect.size.y) return;
+        uint8_t *dst = pixels.ptrw() + (size_t)rect.position.y * dst_row + (size_t)rect.position.x * 4;
+        pixel_kernels::copy_rect(dst, dst_row, bytes.ptr(), src_row, src_row, rect.size.y);
+        dirty = true;
+    }
+
+    void flush() {
+        if (!dirty) return;
+        auto &stats = RiveStats::get_singleton().frame();
+        ScopedTimer timer(stats.upload_nsec);
+        stats.uploaded_bytes += pixels.size();
+        image->set_data(ATLAS_PAGE_SIZE, height, false, Image::FORMAT_RGBA8, pixels);
+        texture->update(image);
+        dirty = false;
+    }
+};
+
+/**
+ * Up to ATLAS_PAGE_SIZE rows of shelves. Viewers write into their slot during process; each dirty shelf is uploaded
+ * once, the first time any member draws in a frame.
+ */
+struct AtlasPage {
+    struct Released {
+        int shelf;
+        Rect2i rect;
+    };
+
+    std::vector<AtlasShelf> shelves;
+    std::vector<Released> released;
+    int used_height = 0;
+    int slots = 0;
+
+    bool allocate(int w, int h, AtlasSlot &out) {
+        const int pw = w + ATLAS_PADDING, ph = h + ATLAS_PADDING;
+
+        // Reuse a released slot first; viewers of the same size come and go together
+        for (int i = 0; i < released.size(); i++) {
+            const Released entry = released[i];
+            if (entry.rect.size.x >= pw && entry.rect.size.y >= ph) {
+                out.shelf = entry.shelf;
+                out.rect = Rect2i(entry.rect.position, Vector2i(w, h));
+                // The whole old rect, since a smaller slot leaves part of it next to the new gutter
+                shelves[entry.shelf].clear(entry.rect);
+                released.erase(released.begin() + i);
+                slots++;
+                return true;
+            }
+        }
+
+        int best = -1;
+        for (int i = 0; i < shelves.size(); i++)
+            if (shelves[i].height >= ph && shelves[i].x + pw <= ATLAS_PAGE_SIZE &&
+                (best == -1 || shelves[i].height < shelves[best].height))
+                best = i;
+        if (best == -1) {
+            if (used_height + ph > ATLAS_PAGE_SIZE) return false;
+            shelves.emplace_back(ph);
+            used_height += ph;
+            best = shelves.size() - 1;
+        }
+        AtlasShelf &shelf = shelves[best];
+        out.shelf = best;
+        out.rect = Rect2i(shelf.x, 0, w, h);
+        shelf.clear(Rect2i(shelf.x, 0, pw, shelf.height));
+        shelf.x += pw;
+        slots++;
+        return true;
+    }
+
+    void release(const AtlasSlot &slot) {
+        const Vector2i padded = slot.rect.size + Vector2i(ATLAS_PADDING, ATLAS_PADDING);
+        released.push_back({ slot.shelf, Rect2i(slot.rect.position, padded) });
+        slots--;
+    }
+
+    void flush() {
+        for (AtlasShelf &shelf : shelves) shelf.flush();
+    }
+};
+
+class TextureAtlas {
+   private:
+    std::vector<Ptr<AtlasPage>> pages;
+
+   public:
+    static TextureAtlas &get_singleton() {
+        static TextureAtlas singleton;
+        return singleton;
+    }
+
+    static bool fits(int w, int h) {
+        return w <= ATLAS_MAX_SLOT_SIZE && h <= ATLAS_MAX_SLOT_SIZE;
+    }
+
+    AtlasSlot allocate(int w, int h) {
+        AtlasSlot slot;
+        if (!fits(w, h)) return slot;
+        for (int i = 0; i < pages.size(); i++) {
+            if (pages[i] && pages[i]->allocate(w, h, slot)) {
+                slot.page = i;
+                return slot;
+            }
+        }
+        auto page = std::make_unique<AtlasPage>();
+        if (!page->allocate(w, h, slot)) return slot;
+        auto hole = std::find(pages.begin(), pages.end(), nullptr);
+        slot.page = hole - pages.begin();
+        if (hole == pages.end()) pages.push_back(std::move(page));
+        else *hole = std::move(page);
+        return slot;
+    }
+
+    void release(AtlasSlot &slot) {
+        if (!slot.is_valid() || slot.page >= pages.size() || !pages[slot.page]) return;
+        auto &page = pages[slot.page];
+        page->release(slot);
+        if (page->slots <= 0) page.reset();
+        slot = AtlasSlot();
+    }
+
+    void write(const AtlasSlot &slot, const PackedByteArray &bytes) {
+        if (slot.is_valid() && pages[slot.page]) pages[slot.page]->shelves[slot.shelf].write(slot.rect, bytes);
+    }
+
+    Ref<ImageTexture> texture(const AtlasSlot &slot) {
+        if (!slot.is_valid() || !pages[slot.page]) return nullptr;
+        return pages[slot.page]->shelves[slot.shelf].texture;
+    }
+
+    void flush() {
+        for (auto &page : pages)
+            if (page) page->flush();
+    }
+
+    int get_page_count() const {
+        return std::count_if(pages.begin(), pages.end(), [](const Ptr<AtlasPage> &page) { return page != nullptr; });
+    }
+
+    void clear() {
+        pages.clear();
+    }
+};
+
+#endif
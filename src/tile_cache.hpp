@@ -0,0 +1,226 @@
+#ifndef _RIVEEXTENSION_TILE_CACHE_HPP_
+#define _RIVEEXTENSION_TILE_CACHE_HPP_
+
+// stdlib
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/canvas_item.hpp>
+#include <godot_cpp/classes/image.hpp>
+#include <godot_cpp/classes/image_texture.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+// rive-cpp
+#include <rive/math/mat2d.hpp>
+
+// skia
+#include <skia/dependencies/skia/include/core/SkBBHFactory.h>
+#include <skia/dependencies/skia/include/core/SkCanvas.h>
+#include <skia/dependencies/skia/include/core/SkPicture.h>
+#include <skia/dependencies/skia/include/core/SkPictureRecorder.h>
+#include <skia/dependencies/skia/include/core/SkSurface.h>
+
+// extension
+#include "rive_stats.hpp"
+#include "utils/draw_fingerprint.hpp"
+#include "utils/pixel_kernels.hpp"
+
+using namespace godot;
+
+static const int TILE_CACHE_TILE_SIZE = 256;
+// Tiles carry a one pixel gutter so linear filtering never samples past their edge
+static const int TILE_CACHE_GUTTER = 1;
+static const int TILE_CACHE_LEVELS_PER_OCTAVE = 4;
+static const int TILE_CACHE_MAX_TILES = 128;
+
+/**
+ * Rasterized tiles of one artboard, keyed by (zoom level, column, row) in artboard space. Zoom is quantized to a few
+ * levels per octave and tiles are rendered at the level just above the on-screen scale, so they are only ever
+ * minified. Panning reuses every tile still in view, and after the artboard changes only tiles whose fingerprint
+ * changed are rasterized again.
+ */
+class TileCache {
+   private:
+    struct Key {
+        int level, x, y;
+
+        bool operator<(const Key &other) const {
+            if (level != other.level) return level < other.level;
+            if (y != other.y) return y < other.y;
+            return x < other.x;
+        }
+    };
+
+    struct Tile {
+        Ref<Image> image;
+        Ref<ImageTexture> texture;
+        uint64_t hash = 0;
+        uint64_t last_used = 0;
+    };
+
+    struct Visible {
+        Key key;
+        Rect2 rect;
+    };
+
+    std::map<Key, Tile> tiles;
+    std::vector<Visible> visible;
+    sk_sp<SkSurface> scratch;
+    SkAlphaType alpha_type = kUnpremul_SkAlphaType;
+    uint64_t clock = 0;
+
+    static float level_scale(int level) {
+        return std::exp2((float)level / TILE_CACHE_LEVELS_PER_OCTAVE);
+    }
+
+    bool rasterize(const Key &key, Tile &tile, const sk_sp<SkPicture> &picture) {
+        const int size = TILE_CACHE_TILE_SIZE + TILE_CACHE_GUTTER * 2;
+        if (!scratch) {
+            auto info = SkImageInfo::Make(size, size, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+            scratch = SkSurfaces::Raster(info);
+            if (!scratch) return false;
+        }
+        const float scale = level_scale(key.level);
+        {
+            ScopedTimer timer(RiveStats::get_singleton().frame().raster_nsec);
+            SkCanvas *canvas = scratch->getCanvas();
+            canvas->resetMatrix();
+            canvas->clear(SkColors::kTransparent);
+            canvas->translate(
+                TILE_CACHE_GUTTER - key.x * TILE_CACHE_TILE_SIZE, TILE_CACHE_GUTTER - key.y * TILE_CACHE_TILE_SIZE
+            );
+            canvas->scale(scale, scale);
+            canvas->drawPicture(picture);
+        }
+
+        SkPixmap pixels;
+        if (!scratch->peekPixels(&pixels)) return false;
+        const size_t row = (size_t)size * 4;
+        PackedByteArray bytes;
+        bytes.resize(row * size);
+        if (alpha_type == kPremul_SkAlphaType)
+            pixel_kernels::copy_rect(bytes.ptrw(), row, pixels.addr8(), pixels.rowBytes(), row, size);
+        else
+            for (int y = 0; y < size; y++) pixel_kernels::unpremultiply(bytes.ptrw() + y * row, pixels.addr8(0, y), size);
+
+        // The readback above is left out of both timers; tiles are small and rarely redrawn
+        auto &stats = RiveStats::get_singleton().frame();
+        ScopedTimer timer(stats.upload_nsec);
+        stats.uploaded_bytes += bytes.size();
+        if (tile.image.is_null()) {
+            tile.image = Image::create_from_data(size, size, false, Image::FORMAT_RGBA8, bytes);
+            tile.texture = ImageTexture::create_from_image(tile.image);
+        } else {
+            tile.image->set_data(size, size, false, Image::FORMAT_RGBA8, bytes);
+            tile.texture->update(tile.image);
+        }
+        return true;
+    }
+
+    void evict() {
+        if (tiles.size() <= TILE_CACHE_MAX_TILES) return;
+        std::vector<std::pair<uint64_t, Key>> order;
+        for (auto &entry : tiles)
+            if (entry.second.last_used != clock) order.push_back({ entry.second.last_used, entry.first });
+        std::sort(order.begin(), order.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        for (size_t i = 0; i < order.size() && tiles.size() > TILE_CACHE_MAX_TILES; i++) tiles.erase(order[i].second);
+    }
+
+   public:
+    /* Records the artboard's draw into a picture that tiles can be played back from. */
+    template <typename Draw>
+    static sk_sp<SkPicture> record(Rect2 bounds, Draw draw) {
+        SkRTreeFactory rtree;
+        SkPictureRecorder recorder;
+        SkRect rect = SkRect::MakeXYWH(bounds.position.x, bounds.position.y, bounds.size.x, bounds.size.y);
+        draw(recorder.beginRecording(rect, &rtree));
+        return recorder.finishRecordingAsPicture();
+    }
+
+    /**
+     * Brings the tiles covering the viewer up to date. `view` maps artboard space to the viewer's local pixels and
+     * `bounds` is the artboard's extent. Returns true if any tile was rasterized.
+     */
+    bool update(const sk_sp<SkPicture> &picture, const rive::Mat2D &view, Vector2 size, Rect2 bounds) {
+        clock++;
+        visible.clear();
+        if (!picture || !bounds.has_area()) return false;
+
+        const float scale = std::max(std::abs(view.xx()), std::abs(view.yy()));
+        if (scale <= 0) return false;
+        const int level = (int)std::ceil(std::log2(scale) * TILE_CACHE_LEVELS_PER_OCTAVE - 1e-3f);
+        const float tile_extent = TILE_CACHE_TILE_SIZE / level_scale(level);
+
+        // Artboard region in view, clipped to the artboard itself
+        rive::Mat2D inverse = view.invertOrIdentity();
+        rive::Vec2D a = inverse * rive::Vec2D(0, 0), b = inverse * rive::Vec2D(size.x, size.y);
+        Rect2 region = Rect2(std::min(a.x, b.x), std::min(a.y, b.y), std::abs(b.x - a.x), std::abs(b.y - a.y));
+        region = region.intersection(bounds);
+        if (!region.has_area()) return false;
+
+        DrawFingerprint fingerprint(picture->cullRect().roundOut());
+        picture->playback(&fingerprint);
+
+        bool changed = false;
+        const int x0 = std::floor(region.position.x / tile_extent), x1 = std::ceil(region.get_end().x / tile_extent);
+        const int y0 = std::floor(region.position.y / tile_extent), y1 = std::ceil(region.get_end().y / tile_extent);
+        for (int y = y0; y < y1; y++) {
+            for (int x = x0; x < x1; x++) {
+                Key key = { level, x, y };
+                Rect2 area = Rect2(x * tile_extent, y * tile_extent, tile_extent, tile_extent);
+                SkRect sk_area = SkRect::MakeXYWH(area.position.x, area.position.y, area.size.x, area.size.y);
+                uint64_t hash = 0;
+                for (const DrawFingerprint::Op &op : fingerprint.ops)
+                    if (SkRect::Intersects(op.bounds, sk_area)) hash = fingerprint_mix(hash, op.hash);
+
+                auto found = tiles.find(key);
+                if (found == tiles.end() || found->second.hash != hash) {
+                    Tile &tile = tiles[key];
+                    if (!rasterize(key, tile, picture)) {
+                        tiles.erase(key);
+                        continue;
+                    }
+                    tile.hash = hash;
+                    changed = true;
+                }
+                tiles[key].last_used = clock;
+
+                rive::Vec2D p0 = view * rive::Vec2D(area.position.x, area.position.y);
+                rive::Vec2D p1 = view * rive::Vec2D(area.get_end().x, area.get_end().y);
+                visible.push_back({ key, Rect2(p0.x, p0.y, p1.x - p0.x, p1.y - p0.y) });
+            }
+        }
+        evict();
+        return changed;
+    }
+
+    /* Draws the tiles found by the last update(). */
+    void draw(CanvasItem *item) const {
+        const Rect2 source = Rect2(TILE_CACHE_GUTTER, TILE_CACHE_GUTTER, TILE_CACHE_TILE_SIZE, TILE_CACHE_TILE_SIZE);
+        for (const Visible &entry : visible) {
+            auto found = tiles.find(entry.key);
+            if (found != tiles.end()) item->draw_texture_rect_region(found->second.texture, entry.rect, source);
+        }
+    }
+
+    int get_count() const {
+        return tiles.size();
+    }
+
+    /* Tiles are stored with the viewer's alpha type; changing it drops every tile. */
+    void set_alpha_type(SkAlphaType value) {
+        if (value == alpha_type) return;
+        alpha_type = value;
+        clear();
+    }
+
+    void clear() {
+        tiles.clear();
+        visible.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef _RIVEEXTENSION_TILED_RASTER_HPP_
+#define _RIVEEXTENSION_TILED_RASTER_HPP_
+
+// stdlib
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/classes/project_settings.hpp>
+
+// skia
+#include <skia/dependencies/skia/include/core/SkCanvas.h>
+#include <skia/dependencies/skia/include/core/SkPicture.h>
+#include <skia/dependencies/skia/include/core/SkPixmap.h>
+#include <skia/dependencies/skia/include/core/SkSurface.h>
+
+using namespace godot;
+
+static const char *TILED_RASTER_THRESHOLD_SETTING = "rive/raster/tiled_threshold_pixels";
+static const int TILED_RASTER_DEFAULT_THRESHOLD = 1920 * 1080;
+static const int TILED_RASTER_MIN_STRIP_HEIGHT = 64;
+
+/**
+ * Plays a recorded frame back into a surface's pixels in horizontal strips across worker threads. Every strip draws
+ * straight into its rows of the surface, so nothing needs stitching afterwards. Recorded pictures are immutable and
+ * each strip has its own canvas, so playback needs no locking.
+ */
+class TiledRaster {
+   private:
+    std::vector<std::thread> workers;
+    // Workers the pool starts with when tiling is first used; the calling thread works too
+    const int worker_count = std::clamp((int)std::thread::hardware_concurrency() - 1, 0, 7);
+    std::mutex mutex;
+    std::condition_variable wake, done;
+    std::function<void(int)> job;
+    // generation << 32 | next index, so a worker that missed its job can't claim an index of the next one
+    std::atomic<uint64_t> ticket{ 0 };
+    uint32_t generation = 0;
+    int job_count = 0;
+    int remaining = 0;
+    int active = 0;
+    bool stopping = false;
+
+    TiledRaster() {}
+
+    ~TiledRaster() {
+        stop();
+    }
+
+    /* Claims and runs indices of one job until they run out or a later job replaces it. */
+    void drain(uint32_t job_generation, int count) {
+        while (true) {
+            uint64_t value = ticket.load();
+            do {
+                if ((uint32_t)(value >> 32) != job_generation || (int)(uint32_t)value >= count) return;
+            } while (!ticket.compare_exchange_weak(value, value + 1));
+            // The job can't be replaced while one of its indices is outstanding
+            job((int)(uint32_t)value);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--remaining == 0) done.notify_all();
+        }
+    }
+
+    void work(uint32_t seen) {
+        while (true) {
+            uint32_t current;
+            int count;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]() { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = current = generation;
+                count = job_count;
+                active++;
+            }
+            drain(current, count);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active == 0) done.notify_all();
+        }
+    }
+
+    /* Runs fn(0..count-1) across the pool and returns when all calls have finished. */
+    void parallel_for(int count, std::function<void(int)> fn) {
+        uint32_t current;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (workers.empty() && !stopping) {
+                for (int i = 0; i < worker_count; i++)
+                    workers.emplace_back([this, seen = generation]() { work(seen); });
+            }
+            job = std::move(fn);
+            job_count = remaining = count;
+            current = ++generation;
+            ticket = (uint64_t)current << 32;
+        }
+        wake.notify_all();
+        drain(current, count);
+        // Waiting for idle workers too means none can still be reading the job when the next one is posted
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&]() { return remaining == 0 && active == 0; });
+    }
+
+   public:
+    static TiledRaster &get_singleton() {
+        static TiledRaster singleton;
+        return singleton;
+    }
+
+    static int get_threshold() {
+        auto settings = ProjectSettings::get_singleton();
+        if (!settings || !settings->has_setting(TILED_RASTER_THRESHOLD_SETTING)) return TILED_RASTER_DEFAULT_THRESHOLD;
+        return settings->get_setting(TILED_RASTER_THRESHOLD_SETTING);
+    }
+
+    /* True if a surface this size is worth splitting. A threshold of 0 disables tiling. */
+    bool should_tile(int width, int height) const {
+        const int threshold = get_threshold();
+        return worker_count > 0 && threshold > 0 && (int64_t)width * height >= threshold;
+    }
+
+    int get_thread_count() const {
+        return worker_count + 1;
+    }
+
+    /* Joins the workers. Called when the extension unloads, since the threads must not outlive its code. */
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &worker : workers) worker.join();
+        workers.clear();
+    }
+
+    /* Clears the surface and draws the picture into it. Returns false if the surface pixels aren't addressable. */
+    bool play(SkSurface *surface, const sk_sp<SkPicture> &picture) {
+        SkPixmap pixels;
+        if (!surface || !picture || !surface->peekPixels(&pixels)) return false;
+
+        const int width = pixels.width(), height = pixels.height();
+        // A couple of strips per thread evens out strips that happen to hold most of the art
+        const int strips = std::clamp(height / TILED_RASTER_MIN_STRIP_HEIGHT, 1, get_thread_count() * 2);
+        const int strip_height = (height + strips - 1) / strips;
+
+        parallel_for(strips, [&](int strip) {
+            const int top = strip * strip_height;
+            const int rows = std::min(strip_height, height - top);
+            if (rows <= 0) return;
+            SkImageInfo info = pixels.info().makeWH(width, rows);
+            auto canvas = SkCanvas::MakeRasterDirect(info, pixels.writable_addr(0, top), pixels.rowBytes());
+            if (!canvas) return;
+            canvas->clear(SkColors::kTransparent);
+            canvas->translate(0, -top);
+            canvas->drawPicture(picture);
+        });
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef _RIVEEXTENSION_DRAW_FINGERPRINT_HPP_
+#define _RIVEEXTENSION_DRAW_FINGERPRINT_HPP_
+
+// stdlib
+#include <climits>
+#include <cstring>
+#include <vector>
+
+// skia
+#include <skia/dependencies/skia/include/core/SkCanvas.h>
+#include <skia/dependencies/skia/include/core/SkImage.h>
+#include <skia/dependencies/skia/include/core/SkPath.h>
+#include <skia/dependencies/skia/include/core/SkVertices.h>
+#include <skia/dependencies/skia/include/utils/SkNWayCanvas.h>
+#include <skia/dependencies/skia/include/utils/SkNoDrawCanvas.h>
+
+static uint64_t fingerprint_mix(uint64_t hash, uint64_t value) {
+    return hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+}
+
+static uint64_t fingerprint_mix(uint64_t hash, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return fingerprint_mix(hash, (uint64_t)bits);
+}
+
+/**
+ * Replays a recorded frame without drawing anything, keeping the bounds and a fingerprint of every draw. Fingerprints
+ * cover the geometry (Skia bumps a path's generation ID whenever Rive rebuilds it), the paint, the matrix and the clip,
+ * so a region whose overlapping fingerprints are unchanged would rasterize to the same pixels.
+ *
+ * Draws are counted in the order they arrive, including ones clipped away (they get empty bounds), so op indices line
+ * up with DrawRangeCanvas. Only the draw calls SkiaRenderer issues are tracked.
+ */
+class DrawFingerprint : public SkNoDrawCanvas {
+   public:
+    struct Op {
+        SkRect bounds;
+        uint64_t hash;
+    };
+
+    std::vector<Op> ops;
+
+    DrawFingerprint(const SkIRect &bounds) : SkNoDrawCanvas(bounds) {}
+
+   private:
+    std::vector<uint64_t> clip_stack;
+    uint64_t clip = 0;
+
+    uint64_t hash_state(uint64_t hash) const {
+        SkMatrix matrix = getTotalMatrix();
+        for (int i = 0; i < 9; i++) hash = fingerprint_mix(hash, matrix.get(i));
+        return fingerprint_mix(hash, clip);
+    }
+
+    static uint64_t hash_paint(uint64_t hash, const SkPaint &paint) {
+        hash = fingerprint_mix(hash, (uint64_t)paint.getColor());
+        hash = fingerprint_mix(hash, paint.getStrokeWidth());
+        hash = fingerprint_mix(hash, (uint64_t)paint.getStyle());
+        hash = fingerprint_mix(hash, (uint64_t)paint.getStrokeJoin() << 8 | (uint64_t)paint.getStrokeCap());
+        hash = fingerprint_mix(hash, (uint64_t)paint.getBlendMode_or(SkBlendMode::kSrcOver));
+        // Rive creates a new shader whenever a gradient changes
+        return fingerprint_mix(hash, (uint64_t)(uintptr_t)paint.getShader());
+    }
+
+    void add(const SkRect &local, const SkPaint *paint, uint64_t hash) {
+        SkRect clip_bounds = SkRect::Make(getDeviceClipBounds());
+        SkRect bounds = local;
+        // Paints with effects that can grow without limit count as covering everything inside the clip
+        if (paint && !paint->canComputeFastBounds()) bounds = clip_bounds;
+        else bounds = getTotalMatrix().mapRect(paint ? paint->computeFastBounds(local, &bounds) : local);
+        if (!bounds.intersect(clip_bounds)) bounds = SkRect::MakeEmpty();
+        ops.push_back({ bounds, hash_state(paint ? hash_paint(hash, *paint) : hash) });
+    }
+
+   protected:
+    void willSave() override {
+        clip_stack.push_back(clip);
+    }
+
+    SaveLayerStrategy getSaveLayerStrategy(const SaveLayerRec &rec) override {
+        clip_stack.push_back(clip);
+        return SkNoDrawCanvas::getSaveLayerStrategy(rec);
+    }
+
+    void willRestore() override {
+        if (clip_stack.empty()) return;
+        clip = clip_stack.back();
+        clip_stack.pop_back();
+    }
+
+    void onClipPath(const SkPath &path, SkClipOp op, ClipEdgeStyle style) override {
+        clip = fingerprint_mix(hash_state(fingerprint_mix(clip, (uint64_t)path.getGenerationID())), (uint64_t)op);
+        SkNoDrawCanvas::onClipPath(path, op, style);
+    }
+
+    void onClipRect(const SkRect &rect, SkClipOp op, ClipEdgeStyle style) override {
+        uint64_t hash = fingerprint_mix(fingerprint_mix(clip, rect.left()), rect.top());
+        clip = fingerprint_mix(hash_state(fingerprint_mix(fingerprint_mix(hash, rect.right()), rect.bottom())), (uint64_t)op);
+        SkNoDrawCanvas::onClipRect(rect, op, style);
+    }
+
+    void onDrawPath(const SkPath &path, const SkPaint &paint) override {
+        add(path.getBounds(), &paint, fingerprint_mix((uint64_t)path.getGenerationID(), (uint64_t)path.getFillType()));
+    }
+
+    void onDrawRect(const SkRect &rect, const SkPaint &paint) override {
+        uint64_t hash = fingerprint_mix(fingerprint_mix(0ull, rect.left()), rect.top());
+        add(rect, &paint, fingerprint_mix(fingerprint_mix(hash, rect.right()), rect.bottom()));
+    }
+
+    void onDrawPaint(const SkPaint &paint) override {
+        add(SkRect::Make(getDeviceClipBounds()), nullptr, hash_paint(0, paint));
+    }
+
+    void onDrawImage2(
+        const SkImage *image, SkScalar x, SkScalar y, const SkSamplingOptions &sampling, const SkPaint *paint
+    ) override {
+        uint64_t hash = fingerprint_mix(fingerprint_mix((uint64_t)image->uniqueID(), x), y);
+        add(SkRect::MakeXYWH(x, y, image->width(), image->height()), paint, hash);
+    }
+
+    void onDrawImageRect2(
+        const SkImage *image,
+        const SkRect &src,
+        const SkRect &dst,
+        const SkSamplingOptions &sampling,
+        const SkPaint *paint,
+        SrcRectConstraint constraint
+    ) override {
+        uint64_t hash = fingerprint_mix(fingerprint_mix((uint64_t)image->uniqueID(), src.left()), src.top());
+        hash = fingerprint_mix(fingerprint_mix(fingerprint_mix(hash, dst.left()), dst.top()), dst.width());
+        add(dst, paint, fingerprint_mix(hash, dst.height()));
+    }
+
+    void onDrawVerticesObject(const SkVertices *vertices, SkBlendMode mode, const SkPaint &paint) override {
+        add(vertices->bounds(), &paint, fingerprint_mix((uint64_t)vertices->uniqueID(), (uint64_t)mode));
+    }
+};
+
+/**
+ * Forwards a replayed frame to its target canvases, but only the draws whose index falls in [begin, end). State
+ * changes (matrix, clip, save/restore) always pass through, so the draws that are kept land exactly where they would
+ * have in a full replay. Counts draws the same way DrawFingerprint does.
+ */
+class DrawRangeCanvas : public SkNWayCanvas {
+   private:
+    int begin, end;
+    int index = 0;
+
+    bool next() {
+        int current = index++;
+        return current >= begin && current < end;
+    }
+
+   public:
+    DrawRangeCanvas(int width, int height, int begin_value, int end_value = INT_MAX)
+        : SkNWayCanvas(width, height), begin(begin_value), end(end_value) {}
+
+   protected:
+    void onDrawPath(const SkPath &path, const SkPaint &paint) override {
+        if (next()) SkNWayCanvas::onDrawPath(path, paint);
+    }
+
+    void onDrawRect(const SkRect &rect, const SkPaint &paint) override {
+        if (next()) SkNWayCanvas::onDrawRect(rect, paint);
+    }
+
+    void onDrawPaint(const SkPaint &paint) override {
+        if (next()) SkNWayCanvas::onDrawPaint(paint);
+    }
+
+    void onDrawImage2(
+        const SkImage *image, SkScalar x, SkScalar y, const SkSamplingOptions &sampling, const SkPaint *paint
+    ) override {
+        if (next()) SkNWayCanvas::onDrawImage2(image, x, y, sampling, paint);
+    }
+
+    void onDrawImageRect2(
+        const SkImage *image,
+        const SkRect &src,
+        const SkRect &dst,
+        const SkSamplingOptions &sampling,
+        const SkPaint *paint,
+        SrcRectConstraint constraint
+    ) override {
+        if (next()) SkNWayCanvas::onDrawImageRect2(image, src, dst, sampling, paint, constraint);
+    }
+
+    void onDrawVerticesObject(const SkVertices *vertices, SkBlendMode mode, const SkPaint &paint) override {
+        if (next()) SkNWayCanvas::onDrawVerticesObject(vertices, mode, paint);
+    }
+};
+
+#endif
@@ -0,0 +1,488 @@
+#include "utils/pixel_kernels.hpp"
+
+// stdlib
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PIXEL_KERNELS_X64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define PIXEL_KERNELS_AVX2
+#else
+#define PIXEL_KERNELS_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define PIXEL_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace pixel_kernels {
+
+typedef void (*Kernel)(uint8_t *dst, const uint8_t *src, size_t count);
+
+struct Table {
+    const char *isa;
+    Kernel premultiply;
+    Kernel unpremultiply;
+    Kernel rgba_to_rgb;
+    Kernel rgba_to_la8;
+    Kernel alpha_to_r8;
+};
+
+/* Scalar */
+
+static inline uint8_t mul255(uint32_t c, uint32_t a) {
+    // Exact round(c * a / 255)
+    uint32_t t = c * a + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static void premultiply_scalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++, src += 4, dst += 4) {
+        const uint8_t a = src[3];
+        dst[0] = mul255(src[0], a);
+        dst[1] = mul255(src[1], a);
+        dst[2] = mul255(src[2], a);
+        dst[3] = a;
+    }
+}
+
+static void unpremultiply_scalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++, src += 4, dst += 4) {
+        const uint32_t a = src[3];
+        if (a == 0) {
+            dst[0] = dst[1] = dst[2] = dst[3] = 0;
+            continue;
+        }
+        for (int c = 0; c < 3; c++) dst[c] = std::min<uint32_t>((src[c] * 255 + a / 2) / a, 255);
+        dst[3] = a;
+    }
+}
+
+static void rgba_to_rgb_scalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++, src += 4, dst += 3) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+    }
+}
+
+static inline uint8_t luma(const uint8_t *px) {
+    return (px[0] * 77 + px[1] * 150 + px[2] * 29 + 128) >> 8;
+}
+
+static void rgba_to_la8_scalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++, src += 4, dst += 2) {
+        const uint8_t a = src[3];
+        dst[0] = luma(src);
+        dst[1] = a;
+    }
+}
+
+static void alpha_to_r8_scalar(uint8_t *dst, const uint8_t *src, size_t count) {
+    for (size_t i = 0; i < count; i++, src += 4) dst[i] = src[3];
+}
+
+static const Table SCALAR = {
+    "scalar",
+    premultiply_scalar,
+    unpremultiply_scalar,
+    rgba_to_rgb_scalar,
+    rgba_to_la8_scalar,
+    alpha_to_r8_scalar,
+};
+
+#ifdef PIXEL_KERNELS_X64
+
+/* SSE2 (baseline on x86-64) */
+
+static inline __m128i alpha_mask_sse2() {
+    return _mm_set1_epi32((int)0xFF000000);
+}
+
+static inline __m128i premultiply_half_sse2(__m128i px) {
+    // px holds two pixels as 16-bit channels; broadcast each pixel's alpha over its four channels
+    __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(px, a), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+static void premultiply_sse2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m128i zero = _mm_setzero_si128(), mask = alpha_mask_sse2();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i px = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        __m128i lo = premultiply_half_sse2(_mm_unpacklo_epi8(px, zero));
+        __m128i hi = premultiply_half_sse2(_mm_unpackhi_epi8(px, zero));
+        __m128i out = _mm_packus_epi16(lo, hi);
+        out = _mm_or_si128(_mm_andnot_si128(mask, out), _mm_and_si128(mask, px));
+        _mm_storeu_si128((__m128i *)(dst + i * 4), out);
+    }
+    premultiply_scalar(dst + i * 4, src + i * 4, count - i);
+}
+
+static inline __m128i unpremultiply_pixel_sse2(__m128i px) {
+    // px is one pixel as four 32-bit channels. Computes the scalar (c * 255 + a / 2) / a exactly: the numerator is
+    // below 2^16, so the correctly rounded float quotient is within 1/512 of the real one, while any non-integer
+    // quotient is at least 1/255 from the next integer. Truncating it gives the same integer
+    __m128i a = _mm_shuffle_epi32(px, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i n = _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(px, 8), px), _mm_srli_epi32(a, 1));
+    __m128 divisor = _mm_cvtepi32_ps(a);
+    __m128 q = _mm_div_ps(_mm_cvtepi32_ps(n), divisor);
+    return _mm_cvttps_epi32(_mm_and_ps(q, _mm_cmpgt_ps(divisor, _mm_setzero_ps())));
+}
+
+static void unpremultiply_sse2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m128i zero = _mm_setzero_si128(), mask = alpha_mask_sse2();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i px = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        __m128i lo = _mm_unpacklo_epi8(px, zero), hi = _mm_unpackhi_epi8(px, zero);
+        __m128i p0 = unpremultiply_pixel_sse2(_mm_unpacklo_epi16(lo, zero));
+        __m128i p1 = unpremultiply_pixel_sse2(_mm_unpackhi_epi16(lo, zero));
+        __m128i p2 = unpremultiply_pixel_sse2(_mm_unpacklo_epi16(hi, zero));
+        __m128i p3 = unpremultiply_pixel_sse2(_mm_unpackhi_epi16(hi, zero));
+        // Saturating packs clamp to 255; alpha is restored from the source. Quotients by a zero alpha are masked to
+        // zero, so fully transparent pixels come out as all zero
+        __m128i out = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+        out = _mm_or_si128(_mm_andnot_si128(mask, out), _mm_and_si128(mask, px));
+        _mm_storeu_si128((__m128i *)(dst + i * 4), out);
+    }
+    unpremultiply_scalar(dst + i * 4, src + i * 4, count - i);
+}
+
+static inline __m128i la8_sse2(__m128i px) {
+    const __m128i byte = _mm_set1_epi32(0xFF);
+    __m128i r = _mm_and_si128(px, byte);
+    __m128i g = _mm_and_si128(_mm_srli_epi32(px, 8), byte);
+    __m128i b = _mm_and_si128(_mm_srli_epi32(px, 16), byte);
+    __m128i a = _mm_srli_epi32(px, 24);
+    __m128i sum = _mm_add_epi32(_mm_mullo_epi16(r, _mm_set1_epi32(77)), _mm_mullo_epi16(g, _mm_set1_epi32(150)));
+    sum = _mm_add_epi32(_mm_add_epi32(sum, _mm_mullo_epi16(b, _mm_set1_epi32(29))), _mm_set1_epi32(128));
+    __m128i la = _mm_or_si128(_mm_srli_epi32(sum, 8), _mm_slli_epi32(a, 8));
+    // Sign-extend the low 16 bits so the signed pack below keeps them bit for bit
+    return _mm_srai_epi32(_mm_slli_epi32(la, 16), 16);
+}
+
+static void rgba_to_la8_sse2(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i p0 = la8_sse2(_mm_loadu_si128((const __m128i *)(src + i * 4)));
+        __m128i p1 = la8_sse2(_mm_loadu_si128((const __m128i *)(src + i * 4 + 16)));
+        _mm_storeu_si128((__m128i *)(dst + i * 2), _mm_packs_epi32(p0, p1));
+    }
+    rgba_to_la8_scalar(dst + i * 2, src + i * 4, count - i);
+}
+
+static void alpha_to_r8_sse2(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i *in = (const __m128i *)(src + i * 4);
+        __m128i a0 = _mm_srli_epi32(_mm_loadu_si128(in), 24), a1 = _mm_srli_epi32(_mm_loadu_si128(in + 1), 24);
+        __m128i a2 = _mm_srli_epi32(_mm_loadu_si128(in + 2), 24), a3 = _mm_srli_epi32(_mm_loadu_si128(in + 3), 24);
+        __m128i out = _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3));
+        _mm_storeu_si128((__m128i *)(dst + i), out);
+    }
+    alpha_to_r8_scalar(dst + i, src + i * 4, count - i);
+}
+
+static const Table SSE2 = {
+    "sse2",
+    premultiply_sse2,
+    unpremultiply_sse2,
+    // Without SSSE3 shuffles there is nothing to gain over the scalar loop
+    rgba_to_rgb_scalar,
+    rgba_to_la8_sse2,
+    alpha_to_r8_sse2,
+};
+
+/* AVX2 */
+
+PIXEL_KERNELS_AVX2 static inline __m256i premultiply_half_avx2(__m256i px) {
+    __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(px, a), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+PIXEL_KERNELS_AVX2 static void premultiply_avx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m256i zero = _mm256_setzero_si256(), mask = _mm256_set1_epi32((int)0xFF000000);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i px = _mm256_loadu_si256((const __m256i *)(src + i * 4));
+        // Unpack and pack both work within 128-bit lanes, so pixel order is preserved
+        __m256i lo = premultiply_half_avx2(_mm256_unpacklo_epi8(px, zero));
+        __m256i hi = premultiply_half_avx2(_mm256_unpackhi_epi8(px, zero));
+        __m256i out = _mm256_packus_epi16(lo, hi);
+        out = _mm256_or_si256(_mm256_andnot_si256(mask, out), _mm256_and_si256(mask, px));
+        _mm256_storeu_si256((__m256i *)(dst + i * 4), out);
+    }
+    premultiply_sse2(dst + i * 4, src + i * 4, count - i);
+}
+
+PIXEL_KERNELS_AVX2 static inline __m256i unpremultiply_pair_avx2(const uint8_t *src) {
+    // Two pixels as eight 32-bit channels, one pixel per 128-bit lane; exact as in unpremultiply_pixel_sse2()
+    __m256i px = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)src));
+    __m256i a = _mm256_shuffle_epi32(px, _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i n = _mm256_add_epi32(_mm256_sub_epi32(_mm256_slli_epi32(px, 8), px), _mm256_srli_epi32(a, 1));
+    __m256 divisor = _mm256_cvtepi32_ps(a);
+    __m256 q = _mm256_div_ps(_mm256_cvtepi32_ps(n), divisor);
+    return _mm256_cvttps_epi32(_mm256_and_ps(q, _mm256_cmp_ps(divisor, _mm256_setzero_ps(), _CMP_GT_OQ)));
+}
+
+PIXEL_KERNELS_AVX2 static void unpremultiply_avx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m256i mask = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const uint8_t *in = src + i * 4;
+        __m256i px = _mm256_loadu_si256((const __m256i *)in);
+        __m256i p01 = unpremultiply_pair_avx2(in), p23 = unpremultiply_pair_avx2(in + 8);
+        __m256i p45 = unpremultiply_pair_avx2(in + 16), p67 = unpremultiply_pair_avx2(in + 24);
+        // Lanes end up holding pixels 0,2,4,6 and 1,3,5,7; the permute puts them back in order
+        __m256i out = _mm256_packus_epi16(_mm256_packs_epi32(p01, p23), _mm256_packs_epi32(p45, p67));
+        out = _mm256_permutevar8x32_epi32(out, order);
+        out = _mm256_or_si256(_mm256_andnot_si256(mask, out), _mm256_and_si256(mask, px));
+        _mm256_storeu_si256((__m256i *)(dst + i * 4), out);
+    }
+    unpremultiply_sse2(dst + i * 4, src + i * 4, count - i);
+}
+
+PIXEL_KERNELS_AVX2 static void rgba_to_rgb_avx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m256i shuffle = _mm256_setr_epi8(
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+    );
+    const __m256i order = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+    size_t i = 0;
+    // Each store writes 32 bytes of which 24 are pixels, so stop while the rest still fits in dst
+    for (; i + 11 <= count; i += 8) {
+        __m256i px = _mm256_loadu_si256((const __m256i *)(src + i * 4));
+        __m256i out = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(px, shuffle), order);
+        _mm256_storeu_si256((__m256i *)(dst + i * 3), out);
+    }
+    rgba_to_rgb_scalar(dst + i * 3, src + i * 4, count - i);
+}
+
+PIXEL_KERNELS_AVX2 static inline __m256i la8_avx2(__m256i px) {
+    const __m256i byte = _mm256_set1_epi32(0xFF);
+    __m256i r = _mm256_and_si256(px, byte);
+    __m256i g = _mm256_and_si256(_mm256_srli_epi32(px, 8), byte);
+    __m256i b = _mm256_and_si256(_mm256_srli_epi32(px, 16), byte);
+    __m256i a = _mm256_srli_epi32(px, 24);
+    __m256i sum = _mm256_add_epi32(
+        _mm256_mullo_epi16(r, _mm256_set1_epi32(77)), _mm256_mullo_epi16(g, _mm256_set1_epi32(150))
+    );
+    sum = _mm256_add_epi32(
+        _mm256_add_epi32(sum, _mm256_mullo_epi16(b, _mm256_set1_epi32(29))), _mm256_set1_epi32(128)
+    );
+    __m256i la = _mm256_or_si256(_mm256_srli_epi32(sum, 8), _mm256_slli_epi32(a, 8));
+    return _mm256_srai_epi32(_mm256_slli_epi32(la, 16), 16);
+}
+
+PIXEL_KERNELS_AVX2 static void rgba_to_la8_avx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i p0 = la8_avx2(_mm256_loadu_si256((const __m256i *)(src + i * 4)));
+        __m256i p1 = la8_avx2(_mm256_loadu_si256((const __m256i *)(src + i * 4 + 32)));
+        __m256i out = _mm256_permute4x64_epi64(_mm256_packs_epi32(p0, p1), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256((__m256i *)(dst + i * 2), out);
+    }
+    rgba_to_la8_sse2(dst + i * 2, src + i * 4, count - i);
+}
+
+PIXEL_KERNELS_AVX2 static void alpha_to_r8_avx2(uint8_t *dst, const uint8_t *src, size_t count) {
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i *in = (const __m256i *)(src + i * 4);
+        __m256i a0 = _mm256_srli_epi32(_mm256_loadu_si256(in), 24);
+        __m256i a1 = _mm256_srli_epi32(_mm256_loadu_si256(in + 1), 24);
+        __m256i a2 = _mm256_srli_epi32(_mm256_loadu_si256(in + 2), 24);
+        __m256i a3 = _mm256_srli_epi32(_mm256_loadu_si256(in + 3), 24);
+        __m256i out = _mm256_packus_epi16(_mm256_packs_epi32(a0, a1), _mm256_packs_epi32(a2, a3));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permutevar8x32_epi32(out, order));
+    }
+    alpha_to_r8_sse2(dst + i, src + i * 4, count - i);
+}
+
+static const Table AVX2 = {
+    "avx2",
+    premultiply_avx2,
+    unpremultiply_avx2,
+    rgba_to_rgb_avx2,
+    rgba_to_la8_avx2,
+    alpha_to_r8_avx2,
+};
+
+static bool has_avx2() {
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 1);
+    const bool os_saves_ymm = (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+    __cpuidex(regs, 7, 0);
+    return os_saves_ymm && (regs[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+#ifdef PIXEL_KERNELS_NEON
+
+/* NEON (baseline on AArch64) */
+
+static inline uint8x8_t mul255_neon(uint8x8_t c, uint8x8_t a) {
+    uint16x8_t t = vmull_u8(c, a);
+    return vraddhn_u16(t, vrshrq_n_u16(t, 8));
+}
+
+static void premultiply_neon(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint8x8x4_t px = vld4_u8(src + i * 4);
+        px.val[0] = mul255_neon(px.val[0], px.val[3]);
+        px.val[1] = mul255_neon(px.val[1], px.val[3]);
+        px.val[2] = mul255_neon(px.val[2], px.val[3]);
+        vst4_u8(dst + i * 4, px);
+    }
+    premultiply_scalar(dst + i * 4, src + i * 4, count - i);
+}
+
+static inline uint8x8_t unpremultiply_channel_neon(uint8x8_t c, uint8x8_t a, float32x4_t a_lo, float32x4_t a_hi) {
+    // (c * 255 + a / 2) / a, exact as in unpremultiply_pixel_sse2()
+    uint16x8_t n = vmlal_u8(vmovl_u8(vshr_n_u8(a, 1)), c, vdup_n_u8(255));
+    float32x4_t lo = vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(n))), a_lo);
+    float32x4_t hi = vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(n))), a_hi);
+    uint16x8_t out = vcombine_u16(vqmovn_u32(vcvtq_u32_f32(lo)), vqmovn_u32(vcvtq_u32_f32(hi)));
+    // Transparent pixels divide by zero; their color comes out as zero
+    return vand_u8(vqmovn_u16(out), vtst_u8(a, a));
+}
+
+static void unpremultiply_neon(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint8x8x4_t px = vld4_u8(src + i * 4);
+        uint16x8_t a = vmovl_u8(px.val[3]);
+        float32x4_t a_lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(a)));
+        float32x4_t a_hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(a)));
+        px.val[0] = unpremultiply_channel_neon(px.val[0], px.val[3], a_lo, a_hi);
+        px.val[1] = unpremultiply_channel_neon(px.val[1], px.val[3], a_lo, a_hi);
+        px.val[2] = unpremultiply_channel_neon(px.val[2], px.val[3], a_lo, a_hi);
+        vst4_u8(dst + i * 4, px);
+    }
+    unpremultiply_scalar(dst + i * 4, src + i * 4, count - i);
+}
+
+static void rgba_to_rgb_neon(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t px = vld4q_u8(src + i * 4);
+        uint8x16x3_t out = { { px.val[0], px.val[1], px.val[2] } };
+        vst3q_u8(dst + i * 3, out);
+    }
+    rgba_to_rgb_scalar(dst + i * 3, src + i * 4, count - i);
+}
+
+static void rgba_to_la8_neon(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint8x8x4_t px = vld4_u8(src + i * 4);
+        uint16x8_t sum = vmull_u8(px.val[0], vdup_n_u8(77));
+        sum = vmlal_u8(sum, px.val[1], vdup_n_u8(150));
+        sum = vmlal_u8(sum, px.val[2], vdup_n_u8(29));
+        uint8x8x2_t out = { { vrshrn_n_u16(sum, 8), px.val[3] } };
+        vst2_u8(dst + i * 2, out);
+    }
+    rgba_to_la8_scalar(dst + i * 2, src + i * 4, count - i);
+}
+
+static void alpha_to_r8_neon(uint8_t *dst, const uint8_t *src, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) vst1q_u8(dst + i, vld4q_u8(src + i * 4).val[3]);
+    alpha_to_r8_scalar(dst + i, src + i * 4, count - i);
+}
+
+static const Table NEON = {
+    "neon",
+    premultiply_neon,
+    unpremultiply_neon,
+    rgba_to_rgb_neon,
+    rgba_to_la8_neon,
+    alpha_to_r8_neon,
+};
+
+#endif
+
+static const Table &table() {
+    static const Table &selected = []() -> const Table & {
+#if defined(PIXEL_KERNELS_X64)
+        return has_avx2() ? AVX2 : SSE2;
+#elif defined(PIXEL_KERNELS_NEON)
+        return NEON;
+#else
+        return SCALAR;
+#endif
+    }();
+    return selected;
+}
+
+const char *isa() {
+    return table().isa;
+}
+
+void copy_rect(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride, size_t row_bytes, int rows) {
+    // memcpy is already vectorized by the C runtime; the only win left is one call for contiguous rows
+    if (dst_stride == row_bytes && src_stride == row_bytes) {
+        memcpy(dst, src, row_bytes * rows);
+        return;
+    }
+    for (int y = 0; y < rows; y++) memcpy(dst + y * dst_stride, src + y * src_stride, row_bytes);
+}
+
+void premultiply(uint8_t *dst, const uint8_t *src, size_t count) {
+    table().premultiply(dst, src, count);
+}
+
+void unpremultiply(uint8_t *dst, const uint8_t *src, size_t count) {
+    table().unpremultiply(dst, src, count);
+}
+
+void rgba_to_rgb(uint8_t *dst, const uint8_t *src, size_t count) {
+    table().rgba_to_rgb(dst, src, count);
+}
+
+void rgba_to_la8(uint8_t *dst, const uint8_t *src, size_t count) {
+    table().rgba_to_la8(dst, src, count);
+}
+
+void alpha_to_r8(uint8_t *dst, const uint8_t *src, size_t count) {
+    table().alpha_to_r8(dst, src, count);
+}
+
+namespace scalar {
+
+void premultiply(uint8_t *dst, const uint8_t *src, size_t count) {
+    premultiply_scalar(dst, src, count);
+}
+
+void unpremultiply(uint8_t *dst, const uint8_t *src, size_t count) {
+    unpremultiply_scalar(dst, src, count);
+}
+
+void rgba_to_rgb(uint8_t *dst, const uint8_t *src, size_t count) {
+    rgba_to_rgb_scalar(dst, src, count);
+}
+
+void rgba_to_la8(uint8_t *dst, const uint8_t *src, size_t count) {
+    rgba_to_la8_scalar(dst, src, count);
+}
+
+void alpha_to_r8(uint8_t *dst, const uint8_t *src, size_t count) {
+    alpha_to_r8_scalar(dst, src, count);
+}
+
+}  // namespace scalar
+
+}  // namespace pixel_kernels
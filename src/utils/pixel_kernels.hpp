@@ -0,0 +1,44 @@
+#ifndef _RIVEEXTENSION_PIXEL_KERNELS_HPP_
+#define _RIVEEXTENSION_PIXEL_KERNELS_HPP_
+
+// stdlib
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Pixel conversions for the upload path. Each kernel has a scalar version and SIMD versions for SSE2, AVX2 and NEON;
+ * the best one the CPU supports is picked once, on first use. Counts are in pixels, and RGBA means 8 bits per channel
+ * in memory order. Unless noted, dst may alias src.
+ */
+namespace pixel_kernels {
+
+/* Name of the instruction set the kernels dispatch to: "avx2", "sse2", "neon" or "scalar". */
+const char *isa();
+
+/* Copies `rows` rows of `row_bytes` between buffers with any strides, e.g. to compact rows or cut out a sub-rect. */
+void copy_rect(uint8_t *dst, size_t dst_stride, const uint8_t *src, size_t src_stride, size_t row_bytes, int rows);
+
+void premultiply(uint8_t *dst, const uint8_t *src, size_t count);
+void unpremultiply(uint8_t *dst, const uint8_t *src, size_t count);
+
+/* Drops alpha. dst must not overlap src past its own end. */
+void rgba_to_rgb(uint8_t *dst, const uint8_t *src, size_t count);
+/* Rec. 601 luma plus alpha. dst must not overlap src past its own end. */
+void rgba_to_la8(uint8_t *dst, const uint8_t *src, size_t count);
+/* Keeps only alpha, e.g. for coverage masks. dst must not overlap src past its own end. */
+void alpha_to_r8(uint8_t *dst, const uint8_t *src, size_t count);
+
+/* The portable kernels, which every SIMD version must match bit for bit (checked by rive_bench --selftest). */
+namespace scalar {
+
+void premultiply(uint8_t *dst, const uint8_t *src, size_t count);
+void unpremultiply(uint8_t *dst, const uint8_t *src, size_t count);
+void rgba_to_rgb(uint8_t *dst, const uint8_t *src, size_t count);
+void rgba_to_la8(uint8_t *dst, const uint8_t *src, size_t count);
+void alpha_to_r8(uint8_t *dst, const uint8_t *src, size_t count);
+
+}  // namespace scalar
+
+}  // namespace pixel_kernels
+
+#endif
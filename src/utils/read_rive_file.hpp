@@ -7,6 +7,7 @@
 
 // stdlib
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 // rive
@@ -16,14 +17,21 @@
 #include <rive/span.hpp>
 
 #include "rive_exceptions.hpp"
+#include "rive_stats.hpp"
 #include "utils/godot_macros.hpp"
 #include "utils/out_redirect.hpp"
+#include "utils/trace.hpp"
 #include "utils/types.hpp"
 
 using namespace godot;
 using namespace rive;
 
-static Ptr<File> read_rive_file(String path, Factory *factory) {
+/* The returned file reports its .riv size to RiveStats for as long as it is alive. */
+static std::shared_ptr<File> read_rive_file(String path, Factory *factory) {
+#ifdef RIVE_TRACE_ENABLED
+    TraceContext trace_context(0, path, "");
+#endif
+    RIVE_TRACE(TRACE_IMPORT, trace_context);
     CerrRedirect errs = CerrRedirect();
     try {
         if (path.get_extension().to_lower() != "riv") throw RiveException("No .riv path provided.").no_report();
@@ -39,7 +47,11 @@ static Ptr<File> read_rive_file(String path, Factory *factory) {
         if (result != ImportResult::success)
             throw RiveException(String("Failed to import.\nErrors: ") + String(errs.str().c_str()));
 
-        return file;
+        RiveStats::get_singleton().file_imported(length);
+        return std::shared_ptr<File>(file.release(), [length](File *imported) {
+            RiveStats::get_singleton().file_released(length);
+            delete imported;
+        });
     } catch (RiveException error) {
         error.report();
         return nullptr;
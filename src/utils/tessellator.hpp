@@ -0,0 +1,291 @@
+#ifndef _RIVEEXTENSION_UTILS_TESSELLATOR_HPP_
+#define _RIVEEXTENSION_UTILS_TESSELLATOR_HPP_
+
+// stdlib
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// godot-cpp
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+using namespace godot;
+
+namespace tessellator {
+
+struct Polyline {
+    std::vector<Vector2> points;
+    bool closed = false;
+};
+
+/* Triangles in plain vectors, so the tessellator runs without the engine (see rive_bench --selftest). */
+struct Mesh {
+    std::vector<Vector2> points;
+    std::vector<int32_t> indices;
+};
+
+enum class FillRule { NON_ZERO, EVEN_ODD };
+enum class Join { MITER, ROUND, BEVEL };
+enum class Cap { BUTT, ROUND, SQUARE };
+
+static const int MAX_CURVE_SEGMENTS = 64;
+static const float MITER_LIMIT = 4;
+
+/* Number of line segments keeping a curve within tolerance of its flattened form. */
+static int curve_segments(float deviation, float tolerance) {
+    if (deviation <= tolerance) return 1;
+    return std::clamp((int)std::ceil(std::sqrt(deviation / tolerance)), 1, MAX_CURVE_SEGMENTS);
+}
+
+static void flatten_quad(std::vector<Vector2> &out, Vector2 p0, Vector2 p1, Vector2 p2, float tolerance) {
+    const int count = curve_segments(0.25f * (p0 - p1 * 2 + p2).length(), tolerance);
+    for (int i = 1; i <= count; i++) {
+        const float t = (float)i / count, u = 1 - t;
+        out.push_back(p0 * (u * u) + p1 * (2 * u * t) + p2 * (t * t));
+    }
+}
+
+static void flatten_cubic(
+    std::vector<Vector2> &out, Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3, float tolerance
+) {
+    const float deviation = 0.75f * std::max((p0 - p1 * 2 + p2).length(), (p1 - p2 * 2 + p3).length());
+    const int count = curve_segments(deviation, tolerance);
+    for (int i = 1; i <= count; i++) {
+        const float t = (float)i / count, u = 1 - t;
+        out.push_back(p0 * (u * u * u) + p1 * (3 * u * u * t) + p2 * (3 * u * t * t) + p3 * (t * t * t));
+    }
+}
+
+static int circle_segments(float radius, float tolerance) {
+    if (radius <= tolerance) return 8;
+    return std::clamp((int)std::ceil(Math_PI / std::acos(1 - tolerance / radius)), 8, MAX_CURVE_SEGMENTS);
+}
+
+static float signed_area(const std::vector<Vector2> &polygon) {
+    float area = 0;
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++)
+        area += polygon[j].x * polygon[i].y - polygon[i].x * polygon[j].y;
+    return area * 0.5f;
+}
+
+/**
+ * Fills polygons with a trapezoid sweep: the plane is cut into horizontal bands at every vertex and edge crossing,
+ * so inside each band edges never cross and the fill rule reduces to counting windings left to right. Handles
+ * self-intersections, holes and both fill rules without a general triangulator.
+ */
+static Mesh fill(const std::vector<Polyline> &polylines, FillRule rule) {
+    struct Edge {
+        Vector2 top, bottom;
+        int winding;
+
+        float x_at(float y) const {
+            const float dy = bottom.y - top.y;
+            return dy > 0 ? top.x + (bottom.x - top.x) * (y - top.y) / dy : top.x;
+        }
+    };
+
+    std::vector<Edge> edges;
+    std::vector<float> ys;
+    for (const Polyline &line : polylines) {
+        const size_t count = line.points.size();
+        if (count < 3) continue;
+        for (size_t i = 0; i < count; i++) {
+            // Fills implicitly close every contour
+            Vector2 a = line.points[i], b = line.points[(i + 1) % count];
+            ys.push_back(a.y);
+            if (a.y == b.y) continue;
+            if (a.y < b.y) edges.push_back({ a, b, 1 });
+            else edges.push_back({ b, a, -1 });
+        }
+    }
+
+    Mesh out;
+    if (edges.empty()) return out;
+
+    std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) { return a.top.y < b.top.y; });
+
+    // Crossing points also split bands
+    for (size_t i = 0; i < edges.size(); i++) {
+        for (size_t j = i + 1; j < edges.size() && edges[j].top.y < edges[i].bottom.y; j++) {
+            const Edge &a = edges[i], &b = edges[j];
+            const float y0 = std::max(a.top.y, b.top.y), y1 = std::min(a.bottom.y, b.bottom.y);
+            if (y1 <= y0) continue;
+            const float d0 = a.x_at(y0) - b.x_at(y0), d1 = a.x_at(y1) - b.x_at(y1);
+            if ((d0 < 0 && d1 > 0) || (d0 > 0 && d1 < 0)) ys.push_back(y0 + (y1 - y0) * d0 / (d0 - d1));
+        }
+    }
+
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    struct Crossing {
+        float top, bottom, middle;
+        int winding;
+    };
+
+    std::vector<const Edge *> active;
+    std::vector<Crossing> crossings;
+    size_t next = 0;
+    for (size_t band = 0; band + 1 < ys.size(); band++) {
+        const float y0 = ys[band], y1 = ys[band + 1];
+        if (y1 - y0 < 1e-6f) continue;
+        const float ym = (y0 + y1) * 0.5f;
+
+        while (next < edges.size() && edges[next].top.y <= y0) active.push_back(&edges[next++]);
+        active.erase(
+            std::remove_if(active.begin(), active.end(), [y0](const Edge *e) { return e->bottom.y <= y0; }),
+            active.end()
+        );
+
+        crossings.clear();
+        for (const Edge *edge : active)
+            if (edge->top.y <= y0 && edge->bottom.y >= y1)
+                crossings.push_back({ edge->x_at(y0), edge->x_at(y1), edge->x_at(ym), edge->winding });
+        std::sort(crossings.begin(), crossings.end(), [](const Crossing &a, const Crossing &b) {
+            return a.middle < b.middle;
+        });
+
+        int winding = 0;
+        const Crossing *start = nullptr;
+        for (const Crossing &crossing : crossings) {
+            const bool was_inside = rule == FillRule::NON_ZERO ? winding != 0 : (winding & 1);
+            winding += crossing.winding;
+            const bool inside = rule == FillRule::NON_ZERO ? winding != 0 : (winding & 1);
+            if (!was_inside && inside) start = &crossing;
+            else if (was_inside && !inside && start) {
+                const int base = out.points.size();
+                out.points.push_back(Vector2(start->top, y0));
+                out.points.push_back(Vector2(crossing.top, y0));
+                out.points.push_back(Vector2(crossing.bottom, y1));
+                out.points.push_back(Vector2(start->bottom, y1));
+                const int quad[6] = { 0, 1, 2, 0, 2, 3 };
+                for (int index : quad) out.indices.push_back(base + index);
+                start = nullptr;
+            }
+        }
+    }
+    return out;
+}
+
+/* Appends a polygon wound counter-clockwise so overlapping pieces union under the non-zero rule. */
+static void add_piece(std::vector<Polyline> &pieces, std::vector<Vector2> points) {
+    if (points.size() < 3) return;
+    if (signed_area(points) < 0) std::reverse(points.begin(), points.end());
+    pieces.push_back({ std::move(points), true });
+}
+
+static void add_disc(std::vector<Polyline> &pieces, Vector2 center, float radius, float tolerance) {
+    const int count = circle_segments(radius, tolerance);
+    std::vector<Vector2> points;
+    points.reserve(count);
+    for (int i = 0; i < count; i++) {
+        const float angle = Math_TAU * i / count;
+        points.push_back(center + Vector2(std::cos(angle), std::sin(angle)) * radius);
+    }
+    add_piece(pieces, std::move(points));
+}
+
+static void add_join(
+    std::vector<Polyline> &pieces, Vector2 vertex, Vector2 in, Vector2 out, float half, Join join, float tolerance
+) {
+    const float turn = in.cross(out);
+    if (std::abs(turn) < 1e-6f && in.dot(out) > 0) return;
+    if (join == Join::ROUND) {
+        add_disc(pieces, vertex, half, tolerance);
+        return;
+    }
+
+    // Only the outer side of the turn needs filling; the segment quads overlap on the inner side
+    const float side = turn > 0 ? -1 : 1;
+    const Vector2 a = vertex + Vector2(-in.y, in.x) * half * side;
+    const Vector2 b = vertex + Vector2(-out.y, out.x) * half * side;
+    if (join == Join::MITER) {
+        const Vector2 bisector = (a - vertex + b - vertex).normalized();
+        const float cos_half = bisector.dot(Vector2(-in.y, in.x) * side);
+        if (cos_half > 1.0f / MITER_LIMIT) {
+            add_piece(pieces, { vertex, a, vertex + bisector * (half / cos_half), b });
+            return;
+        }
+    }
+    add_piece(pieces, { vertex, a, b });
+}
+
+/* Expands polylines into the outline of their stroke, then fills it so overlaps are not blended twice. */
+static Mesh stroke(
+    const std::vector<Polyline> &polylines, float thickness, Join join, Cap cap, float tolerance
+) {
+    const float half = thickness * 0.5f;
+    std::vector<Polyline> pieces;
+    if (half <= 0) return Mesh();
+
+    for (const Polyline &line : polylines) {
+        std::vector<Vector2> points;
+        for (const Vector2 &point : line.points)
+            if (points.empty() || !points.back().is_equal_approx(point)) points.push_back(point);
+        if (line.closed && points.size() > 1 && points.front().is_equal_approx(points.back())) points.pop_back();
+
+        if (points.size() == 1) {
+            if (cap == Cap::ROUND) add_disc(pieces, points[0], half, tolerance);
+            else if (cap == Cap::SQUARE)
+                add_piece(pieces, {
+                    points[0] + Vector2(-half, -half),
+                    points[0] + Vector2(half, -half),
+                    points[0] + Vector2(half, half),
+                    points[0] + Vector2(-half, half),
+                });
+            continue;
+        }
+        if (points.size() < 2) continue;
+
+        const bool closed = line.closed && points.size() > 2;
+        const size_t segments = closed ? points.size() : points.size() - 1;
+        for (size_t i = 0; i < segments; i++) {
+            Vector2 a = points[i], b = points[(i + 1) % points.size()];
+            const Vector2 direction = (b - a).normalized();
+            if (!closed && cap == Cap::SQUARE) {
+                if (i == 0) a -= direction * half;
+                if (i == segments - 1) b += direction * half;
+            }
+            const Vector2 normal = Vector2(-direction.y, direction.x) * half;
+            add_piece(pieces, { a + normal, b + normal, b - normal, a - normal });
+        }
+
+        for (size_t i = closed ? 0 : 1; i < (closed ? points.size() : points.size() - 1); i++) {
+            const size_t prev = (i + points.size() - 1) % points.size(), next = (i + 1) % points.size();
+            const Vector2 in = (points[i] - points[prev]).normalized();
+            const Vector2 out = (points[next] - points[i]).normalized();
+            add_join(pieces, points[i], in, out, half, join, tolerance);
+        }
+
+        if (!closed && cap == Cap::ROUND) {
+            add_disc(pieces, points.front(), half, tolerance);
+            add_disc(pieces, points.back(), half, tolerance);
+        }
+    }
+    return fill(pieces, FillRule::NON_ZERO);
+}
+
+} // namespace tessellator
+
+/* Triangles ready for RenderingServer::canvas_item_add_triangle_array, copied once from a cached mesh. */
+struct Tessellation {
+    PackedVector2Array points;
+    PackedInt32Array indices;
+
+    Tessellation() {}
+
+    Tessellation(const tessellator::Mesh &mesh) {
+        points.resize(mesh.points.size());
+        std::copy(mesh.points.begin(), mesh.points.end(), points.ptrw());
+        indices.resize(mesh.indices.size());
+        std::copy(mesh.indices.begin(), mesh.indices.end(), indices.ptrw());
+    }
+
+    bool is_empty() const {
+        return indices.is_empty();
+    }
+};
+
+#endif
@@ -0,0 +1,288 @@
+#ifndef _RIVEEXTENSION_TRACE_HPP_
+#define _RIVEEXTENSION_TRACE_HPP_
+
+// stdlib
+#include <cstdint>
+
+// Tracing only exists in debug and editor builds; in release builds RIVE_TRACE expands to nothing
+#if defined(DEBUG_ENABLED) && !defined(RIVE_TRACE_ENABLED)
+#define RIVE_TRACE_ENABLED
+#endif
+
+enum TRACE_STAGE : uint16_t {
+    TRACE_PROPERTY_FLUSH = 0,
+    TRACE_LOAD,
+    TRACE_IMPORT,
+    TRACE_INSTANTIATE,
+    TRACE_POINTER,
+    TRACE_ADVANCE,
+    TRACE_RASTER,
+    TRACE_COPY,
+    TRACE_UPLOAD,
+    TRACE_STAGE_COUNT
+};
+
+// Events kept by default; older ones are overwritten
+static const int TRACE_DEFAULT_CAPACITY = 1 << 16;
+
+#ifdef RIVE_TRACE_ENABLED
+
+// stdlib
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// godot-cpp
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/variant/builtin_types.hpp>
+
+using namespace godot;
+
+static const char *TRACE_STAGE_NAMES[TRACE_STAGE_COUNT] = {
+    "property_flush", "load", "import", "instantiate", "pointer", "advance", "raster", "copy", "upload",
+};
+
+/* Labels of a viewer's events. Setting them costs nothing; the first event recorded with them interns them. */
+struct TraceContext {
+    uint64_t viewer = 0;
+    String file;
+    String artboard;
+    // Index in the tracer's table, valid while `generation` matches the table's. Cached on first use, so mutable to
+    // let const owners (e.g. RiveInstance::instantiate() const) trace too
+    mutable uint32_t id = 0;
+    mutable uint32_t generation = 0;
+
+    TraceContext() {}
+
+    TraceContext(uint64_t viewer_value, String file_value, String artboard_value) :
+            viewer(viewer_value), file(file_value), artboard(artboard_value) {}
+};
+
+/**
+ * Ring buffer of complete (begin + duration) events for the Rive pipeline stages, dumped as Chrome trace JSON that
+ * opens in chrome://tracing and Perfetto. Recording an event is two reads of the CPU's timestamp counter, an atomic
+ * increment and a 24 byte store; everything else (viewer, file, artboard, thread name) is interned by the first event
+ * that uses it and referenced by index. Ticks are converted to time when dumping, against the steady clock.
+ */
+class Tracer {
+   public:
+    struct Event {
+        int64_t start;
+        int64_t duration;
+        uint32_t context;
+        uint16_t stage;
+        uint16_t thread;
+    };
+
+   private:
+    struct Context {
+        uint64_t viewer;
+        String file;
+        String artboard;
+    };
+
+    std::atomic<bool> enabled{ false };
+    std::atomic<uint64_t> head{ 0 };
+    std::vector<Event> events;
+    uint64_t mask = 0;
+    const int64_t epoch_ns = steady_ns();
+    const int64_t epoch_ticks = now();
+
+    std::mutex mutex;
+    // Context 0 is "no viewer", for work that isn't tied to one (e.g. imports)
+    std::vector<Context> contexts = { Context{ 0, "", "" } };
+    std::map<String, uint32_t> context_ids;
+    // Bumped whenever the table is emptied, so ids cached in TraceContexts are interned again
+    std::atomic<uint32_t> generation{ 1 };
+    std::vector<String> thread_names;
+
+    /* Called with the mutex held, once no buffered event refers to the table. */
+    void clear_contexts() {
+        contexts.resize(1);
+        context_ids.clear();
+        generation++;
+    }
+
+    uint16_t register_thread() {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto os = OS::get_singleton();
+        bool main = os && os->get_thread_caller_id() == os->get_main_thread_id();
+        thread_names.push_back(main ? String("main") : "thread " + String::num_int64(thread_names.size()));
+        return thread_names.size();
+    }
+
+    static String quote(const String &value) {
+        return JSON::stringify(value);
+    }
+
+    static int64_t steady_ns() {
+        auto time = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+    }
+
+   public:
+    static Tracer &get_singleton() {
+        static Tracer singleton;
+        return singleton;
+    }
+
+    bool is_enabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /* Starts recording into a buffer of at least `capacity` events, keeping what was recorded so far if it fits. */
+    void start(int capacity = TRACE_DEFAULT_CAPACITY) {
+        uint64_t size = 1;
+        while (size < (uint64_t)capacity) size <<= 1;
+        if (size != events.size()) {
+            enabled.store(false);
+            events.assign(size, Event());
+            mask = size - 1;
+            head.store(0);
+            std::lock_guard<std::mutex> lock(mutex);
+            clear_contexts();
+        }
+        enabled.store(true);
+    }
+
+    void stop() {
+        enabled.store(false);
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        head.store(0);
+        clear_contexts();
+    }
+
+    uint64_t get_count() const {
+        return std::min<uint64_t>(head.load(std::memory_order_relaxed), events.size());
+    }
+
+    /* Timestamp in ticks: the TSC on x86, the virtual counter on ARM64, nanoseconds elsewhere. */
+    static int64_t now() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        return (int64_t)__rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return (int64_t)ticks;
+#else
+        return steady_ns();
+#endif
+    }
+
+    /* Id of a context's viewer/file/artboard triple, interning it the first time it is recorded. */
+    uint32_t intern(const TraceContext &context) {
+        if (context.generation == generation.load(std::memory_order_relaxed)) return context.id;
+        std::lock_guard<std::mutex> lock(mutex);
+        String key = String::num_uint64(context.viewer) + "|" + context.file + "|" + context.artboard;
+        auto found = context_ids.find(key);
+        if (found == context_ids.end()) {
+            found = context_ids.emplace(key, (uint32_t)contexts.size()).first;
+            contexts.push_back(Context{ context.viewer, context.file, context.artboard });
+        }
+        context.id = found->second;
+        context.generation = generation.load();
+        return context.id;
+    }
+
+    uint16_t thread_id() {
+        thread_local uint16_t id = 0;
+        if (id == 0) id = register_thread();
+        return id;
+    }
+
+    void record(TRACE_STAGE stage, const TraceContext &context, int64_t start, int64_t end) {
+        const uint32_t id = intern(context);
+        uint64_t index = head.fetch_add(1, std::memory_order_relaxed);
+        events[index & mask] = Event{ start, end - start, id, stage, thread_id() };
+    }
+
+    /* Writes the buffered events, oldest first. Recording is paused while writing. */
+    Error dump(String path) {
+        bool was_enabled = enabled.exchange(false);
+        Ref<FileAccess> out = FileAccess::open(path, FileAccess::WRITE);
+        if (out.is_null()) {
+            enabled.store(was_enabled);
+            return FileAccess::get_open_error();
+        }
+
+        const int64_t elapsed_ticks = now() - epoch_ticks;
+        const double us_per_tick = elapsed_ticks > 0 ? (steady_ns() - epoch_ns) / 1000.0 / elapsed_ticks : 0.0;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        out->store_string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+        for (size_t i = 0; i < thread_names.size(); i++) {
+            out->store_string(
+                String(first ? "" : ",\n") + "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" +
+                String::num_int64(i + 1) + ",\"args\":{\"name\":" + quote(thread_names[i]) + "}}"
+            );
+            first = false;
+        }
+        const uint64_t end = head.load();
+        const uint64_t count = get_count();
+        for (uint64_t i = end - count; i < end; i++) {
+            const Event &event = events[i & mask];
+            const Context &context = contexts[event.context < contexts.size() ? event.context : 0];
+            out->store_string(
+                String(first ? "" : ",\n") + "{\"name\":\"" + TRACE_STAGE_NAMES[event.stage] +
+                "\",\"cat\":\"rive\",\"ph\":\"X\",\"pid\":1,\"tid\":" + String::num_int64(event.thread) +
+                ",\"ts\":" + String::num((event.start - epoch_ticks) * us_per_tick, 3) +
+                ",\"dur\":" + String::num(event.duration * us_per_tick, 3) +
+                ",\"args\":{\"viewer\":" + String::num_uint64(context.viewer) + ",\"file\":" + quote(context.file) +
+                ",\"artboard\":" + quote(context.artboard) + "}}"
+            );
+            first = false;
+        }
+        out->store_string("\n]}\n");
+        out->close();
+        enabled.store(was_enabled);
+        return OK;
+    }
+};
+
+/* Records the time from construction to destruction as one event, if tracing was on when it started. */
+struct TraceScope {
+    int64_t start = -1;
+    const TraceContext &context;
+    TRACE_STAGE stage;
+
+    TraceScope(TRACE_STAGE stage_value, const TraceContext &context_value) :
+            context(context_value), stage(stage_value) {
+        Tracer &tracer = Tracer::get_singleton();
+        if (tracer.is_enabled()) start = tracer.now();
+    }
+
+    ~TraceScope() {
+        if (start < 0) return;
+        Tracer &tracer = Tracer::get_singleton();
+        if (tracer.is_enabled()) tracer.record(stage, context, start, tracer.now());
+    }
+};
+
+#define RIVE_TRACE_CONCAT_INNER(a, b) a##b
+#define RIVE_TRACE_CONCAT(a, b) RIVE_TRACE_CONCAT_INNER(a, b)
+#define RIVE_TRACE(stage, context) TraceScope RIVE_TRACE_CONCAT(_rive_trace_, __LINE__)(stage, context)
+
+#else
+
+struct TraceContext {};
+
+#define RIVE_TRACE(stage, context)
+
+#endif
+
+#endif
@@ -33,6 +33,30 @@ enum ALIGN {
 static const char *AlignEnumPropertyHint
     = "TopLeft:1,TopCenter:2,TopRight:3,CenterLeft:4,Center:5,CenterRight:6,BottomLeft:7,BottomCenter:8,BottomRight:9";
 
+// Mirrors SubViewport's update modes. WHEN_CHANGED matches the original behaviour: advance while visible and only
+// rasterize when the artboard reports a change. MANUAL disables processing entirely (see RiveViewerBase::render_now).
+enum UPDATE_MODE {
+    UPDATE_ALWAYS = 0,
+    UPDATE_WHEN_CHANGED = 1,
+    UPDATE_WHEN_VISIBLE = 2,
+    UPDATE_ONCE = 3,
+    UPDATE_MANUAL = 4
+};
+
+static const char *UpdateModeEnumPropertyHint = "Always:0,WhenChanged:1,WhenVisible:2,Once:3,Manual:4";
+
+// RASTER draws through Skia into a texture. CANVAS tessellates paths into Godot canvas commands (no CPU raster or
+// texture upload), trading antialiasing and blend modes for speed on typical UI art.
+enum BACKEND { RASTER = 0, CANVAS = 1 };
+
+static const char *BackendEnumPropertyHint = "Raster:0,Canvas:1";
+
+// RGB8 is for opaque art: alpha is dropped and the surface isn't cleared between frames. MASK keeps only coverage in
+// one channel and draws it tinted by the node's modulate, for single-color icons.
+enum OUTPUT_FORMAT { OUTPUT_RGBA8 = 0, OUTPUT_RGB8 = 1, OUTPUT_MASK = 2 };
+
+static const char *OutputFormatEnumPropertyHint = "RGBA8:0,RGB8 (Opaque):1,Mask (R8):2";
+
 static rive::Fit convert(FIT fit) {
     switch (fit) {
         case FIT::COVER:
@@ -113,6 +137,17 @@ struct ViewerProps {
     FIT _fit = FIT::CONTAIN;
     ALIGN _alignment = ALIGN::CENTER;
     bool _use_global_input = false;
+    UPDATE_MODE _update_mode = UPDATE_MODE::UPDATE_WHEN_CHANGED;
+    bool _flipbook_cache = false;
+    float _flipbook_fps = 30;
+    bool _sync_group = false;
+    bool _atlas = false;
+    bool _use_pool = false;
+    BACKEND _backend = BACKEND::RASTER;
+    Rect2 _view_rect;
+    bool _static_layer_cache = false;
+    bool _premultiplied_alpha = false;
+    OUTPUT_FORMAT _output_format = OUTPUT_FORMAT::OUTPUT_RGBA8;
 
     /* Events */
     PropEvent<String> path_changed;
@@ -215,6 +250,55 @@ struct ViewerProps {
         return _use_global_input;
     }
 
+    UPDATE_MODE update_mode() const {
+        return _update_mode;
+    }
+
+    bool flipbook_cache() const {
+        return _flipbook_cache;
+    }
+
+    float flipbook_fps() const {
+        return _flipbook_fps;
+    }
+
+    bool sync_group() const {
+        return _sync_group;
+    }
+
+    bool atlas() const {
+        return _atlas;
+    }
+
+    bool use_pool() const {
+        return _use_pool;
+    }
+
+    BACKEND backend() const {
+        return _backend;
+    }
+
+    Rect2 view_rect() const {
+        return _view_rect;
+    }
+
+    bool static_layer_cache() const {
+        return _static_layer_cache;
+    }
+
+    bool premultiplied_alpha() const {
+        return _premultiplied_alpha;
+    }
+
+    OUTPUT_FORMAT output_format() const {
+        return _output_format;
+    }
+
+    /* True if the viewer shows a window of the artboard instead of fitting the whole of it. */
+    bool has_view_rect() const {
+        return _view_rect.has_area();
+    }
+
     Dictionary scene_properties() const {
         return _scene_properties;
     }
@@ -325,6 +409,78 @@ struct ViewerProps {
         }
     }
 
+    void update_mode(UPDATE_MODE value) {
+        if (_update_mode != value) {
+            _update_mode = value;
+        }
+    }
+
+    void flipbook_cache(bool value) {
+        if (_flipbook_cache != value) {
+            _flipbook_cache = value;
+        }
+    }
+
+    void flipbook_fps(float value) {
+        if (_flipbook_fps != value) {
+            _flipbook_fps = std::max(value, 1.0f);
+        }
+    }
+
+    void sync_group(bool value) {
+        if (_sync_group != value) {
+            _sync_group = value;
+        }
+    }
+
+    void atlas(bool value) {
+        if (_atlas != value) {
+            _atlas = value;
+        }
+    }
+
+    void use_pool(bool value) {
+        if (_use_pool != value) {
+            _use_pool = value;
+        }
+    }
+
+    void backend(BACKEND value) {
+        if (_backend != value) {
+            _backend = value;
+        }
+    }
+
+    void static_layer_cache(bool value) {
+        if (_static_layer_cache != value) {
+            _static_layer_cache = value;
+        }
+    }
+
+    void premultiplied_alpha(bool value) {
+        if (_premultiplied_alpha != value) {
+            _premultiplied_alpha = value;
+            // Redraws in the new alpha type
+            transform_changed.emit();
+        }
+    }
+
+    void output_format(OUTPUT_FORMAT value) {
+        if (_output_format != value) {
+            _output_format = value;
+            // Same as a resize: the image, texture and surface are all recreated in the new format
+            size_changed.emit(_width, _height);
+            transform_changed.emit();
+        }
+    }
+
+    void view_rect(Rect2 value) {
+        if (_view_rect != value) {
+            _view_rect = value;
+            transform_changed.emit();
+        }
+    }
+
     void scene_properties(Dictionary value) {
         if (_scene_properties != value) {
             _scene_properties = value;